@@ -289,15 +289,6 @@ newoption {
 	}
 }
 
-newoption {
-	trigger = "OPENMP",
-	description = "OpenMP optimized code.",
-	allowed = {
-		{ "0",   "Disabled"     },
-		{ "1",   "Enabled"      },
-	}
-}
-
 newoption {
 	trigger = "FASTDEBUG",
 	description = "Fast DEBUG.",
@@ -871,22 +862,9 @@ if _OPTIONS["SSE3"]=="1" then
 end
 
 
-if _OPTIONS["OPENMP"]=="1" then
-	buildoptions {
-		"-fopenmp",
-	}
-	linkoptions {
-		"-fopenmp"
-	}
-	defines {
-		"USE_OPENMP=1",
-	}
-
-else
-	buildoptions {
-		"-Wno-unknown-pragmas",
-	}
-end
+buildoptions {
+	"-Wno-unknown-pragmas",
+}
 
 if _OPTIONS["LDOPTS"] then
 	linkoptions {
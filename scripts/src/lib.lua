@@ -29,6 +29,8 @@ project "utils"
 		MAME_DIR .. "src/lib/util/coretmpl.h",
 		MAME_DIR .. "src/lib/util/avhuff.cpp",
 		MAME_DIR .. "src/lib/util/avhuff.h",
+		MAME_DIR .. "src/lib/util/arcindex.cpp",
+		MAME_DIR .. "src/lib/util/arcindex.h",
 		MAME_DIR .. "src/lib/util/aviio.cpp",
 		MAME_DIR .. "src/lib/util/aviio.h",
 		MAME_DIR .. "src/lib/util/bitmap.cpp",
@@ -71,6 +71,7 @@ project("mametests")
 		MAME_DIR .. "3rdparty/googletest/googletest/include",
 		MAME_DIR .. "src/osd",
 		MAME_DIR .. "src/emu",
+		MAME_DIR .. "src/devices",
 		MAME_DIR .. "src/lib/util",
 		ext_includedir("expat"),
 		ext_includedir("zlib"),
@@ -78,7 +79,15 @@ project("mametests")
 
 	files {
 		MAME_DIR .. "tests/main.cpp",
+		MAME_DIR .. "tests/lib/util/arcindex.cpp",
 		MAME_DIR .. "tests/lib/util/corestr.cpp",
 		MAME_DIR .. "tests/emu/attotime.cpp",
+		MAME_DIR .. "tests/devices/sound/aicadsp.cpp",
+		MAME_DIR .. "tests/devices/sound/scspdsp.cpp",
+		MAME_DIR .. "tests/devices/sound/ymf262.cpp",
+		MAME_DIR .. "src/devices/sound/aicadsp.cpp",
+		MAME_DIR .. "src/devices/sound/scspdsp.cpp",
+		MAME_DIR .. "src/emu/attotime.cpp",
+		MAME_DIR .. "src/emu/emualloc.cpp",
 	}
 
@@ -8,6 +8,7 @@ Usage:
 %s h8.lst <type> h8.inc (type = o/h/s20/s26)
 """
 import sys
+import re
 
 def name_to_type(name):
     if name == "o":
@@ -47,9 +48,39 @@ def has_eat(ins):
         return True
     return False
 
+def fast_cycles(source):
+    # Cycles an instruction may use before its last suspension point,
+    # or 0 when it has no checks worth skipping or can't be bounded
+    cycles = 0
+    checks = 0
+    need = 0
+    for line in source:
+        if has_eat(line) or "for(" in line or "while(" in line:
+            return 0
+        if has_memory(line):
+            checks += 1
+            need = cycles
+            cycles += len(re.findall(r"\b(fetch|read8|read16|read16i|write8|write16|prefetch|prefetch_start|prefetch_noirq|prefetch_noirq_notrace)\(", line))
+        for c in re.findall(r"\binternal\(([^)]*)\)", line):
+            if not c.isdigit():
+                return 0
+            cycles += int(c)
+    if checks < 2:
+        return 0
+    return need
+
 def save_full_one(f, t, name, source):
     print("void %s::%s_full()" % (t, name), file=f)
     print("{", file=f)
+    cycles = fast_cycles(source)
+    if cycles:
+        # No internal event can happen before the end of the
+        # instruction, run it without the per-access checks
+        print("\tif(icount > bcount + %d) {" % cycles, file=f)
+        for line in source:
+            print(line, file=f)
+        print("\treturn;", file=f)
+        print("\t}", file=f)
     substate = 1
     for line in source:
         if has_memory(line):
@@ -81,6 +81,20 @@ FULL_NONE="""\
 %(ins)s
 """
 
+FAST_PROLOG="""\
+\tif(icount >= %(cycles)d) {
+"""
+
+FAST_EPILOG="""\
+\treturn;
+\t}
+"""
+
+FAST_MEMORY="""\
+%(ins)s
+\ticount--;
+"""
+
 PARTIAL_PROLOG="""\
 void %(device)s::%(opcode)s_partial()
 {
@@ -118,6 +132,23 @@ def identify_line_type(ins):
     return "NONE"
 
 
+def fast_cycles(instructions):
+    """Number of cycles an instruction needs to run without ever being
+    suspended, or 0 if it can't or has no checks worth skipping."""
+    cycles = 0
+    for ins in instructions:
+        if "for(" in ins or "while(" in ins:
+            return 0
+        line_type = identify_line_type(ins)
+        if line_type == "EAT":
+            return 0
+        elif line_type == "MEMORY":
+            cycles += 1
+    if cycles < 2:
+        return 0
+    return cycles
+
+
 def save_opcodes(f, device, opcodes):
     for name, instructions in opcodes:
         d = { "device": device,
@@ -125,6 +156,20 @@ def save_opcodes(f, device, opcodes):
               }
 
         emit(f, FULL_PROLOG % d)
+
+        # When enough cycles are left the instruction can't be
+        # suspended, so run it without the per-access checks
+        d["cycles"] = fast_cycles(instructions)
+        if d["cycles"]:
+            emit(f, FAST_PROLOG % d)
+            for ins in instructions:
+                d["ins"] = ins
+                if identify_line_type(ins) == "MEMORY":
+                    emit(f, FAST_MEMORY % d)
+                else:
+                    emit(f, FULL_NONE % d)
+            emit(f, FAST_EPILOG % d)
+
         substate = 1
         for ins in instructions:
             d["substate"] = str(substate)
@@ -288,6 +288,7 @@ public:
 
 		offs_t  opcode_xor;                     // Address Calculation
 		m68k_readimm16_delegate readimm16;      // Immediate read 16 bit
+		bool    readimm16_direct;               // readimm16 is a plain m_odirect->read_word(address, opcode_xor)
 		m68k_read8_delegate read8;
 		m68k_read16_delegate read16;
 		m68k_read32_delegate read32;
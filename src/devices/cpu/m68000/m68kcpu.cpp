@@ -1259,6 +1259,7 @@ void m68000_base_device::init8(address_space &space, address_space &ospace)
 	opcode_xor = 0;
 
 	readimm16 = m68k_readimm16_delegate(FUNC(m68000_base_device::m68008_read_immediate_16), this);
+	readimm16_direct = false;
 	read8 = m68k_read8_delegate(FUNC(address_space::read_byte), &space);
 	read16 = m68k_read16_delegate(FUNC(address_space::read_word), &space);
 	read32 = m68k_read32_delegate(FUNC(address_space::read_dword), &space);
@@ -1298,6 +1299,7 @@ void m68000_base_device::init16(address_space &space, address_space &ospace)
 	opcode_xor = 0;
 
 	readimm16 = m68k_readimm16_delegate(FUNC(m68000_base_device::simple_read_immediate_16), this);
+	readimm16_direct = true;
 	read8 = m68k_read8_delegate(FUNC(address_space::read_byte), &space);
 	read16 = m68k_read16_delegate(FUNC(address_space::read_word), &space);
 	read32 = m68k_read32_delegate(FUNC(address_space::read_dword), &space);
@@ -1324,6 +1326,7 @@ void m68000_base_device::init32(address_space &space, address_space &ospace)
 	opcode_xor = WORD_XOR_BE(0);
 
 	readimm16 = m68k_readimm16_delegate(FUNC(m68000_base_device::read_immediate_16), this);
+	readimm16_direct = true;
 	read8 = m68k_read8_delegate(FUNC(address_space::read_byte), &space);
 	read16 = m68k_read16_delegate(FUNC(address_space::read_word_unaligned), &space);
 	read32 = m68k_read32_delegate(FUNC(address_space::read_dword_unaligned), &space);
@@ -1543,6 +1546,7 @@ void m68000_base_device::init32mmu(address_space &space, address_space &ospace)
 	opcode_xor = WORD_XOR_BE(0);
 
 	readimm16 = m68k_readimm16_delegate(FUNC(m68000_base_device::read_immediate_16_mmu), this);
+	readimm16_direct = false;
 	read8 = m68k_read8_delegate(FUNC(m68000_base_device::read_byte_32_mmu), this);
 	read16 = m68k_read16_delegate(FUNC(m68000_base_device::readword_d32_mmu), this);
 	read32 = m68k_read32_delegate(FUNC(m68000_base_device::readlong_d32_mmu), this);
@@ -1671,6 +1675,7 @@ void m68000_base_device::init32hmmu(address_space &space, address_space &ospace)
 	opcode_xor = WORD_XOR_BE(0);
 
 	readimm16 = m68k_readimm16_delegate(FUNC(m68000_base_device::read_immediate_16_hmmu), this);
+	readimm16_direct = false;
 	read8 = m68k_read8_delegate(FUNC(m68000_base_device::read_byte_32_hmmu), this);
 	read16 = m68k_read16_delegate(FUNC(m68000_base_device::readword_d32_hmmu), this);
 	read32 = m68k_read32_delegate(FUNC(m68000_base_device::readlong_d32_hmmu), this);
@@ -2401,6 +2406,7 @@ void m68000_base_device::clear_all()
 	program = nullptr;
 
 	opcode_xor = 0;
+	readimm16_direct = false;
 //  readimm16 = 0;
 //  read8 = 0;
 //  read16 = 0;
@@ -719,6 +719,11 @@ static inline UINT32 m68ki_ic_readimm16(m68000_base_device *m68k, UINT32 address
 		}
 	}
 
+	// fetch straight from the direct-mapped opcode memory when nothing
+	// sits between the core and the address space
+	if (m68k->readimm16_direct)
+		return m68k->m_odirect->read_word(address, m68k->opcode_xor);
+
 	return m68k->readimm16(address);
 }
 
@@ -1329,17 +1329,28 @@ void sh2_device::generate_checksum_block(drcuml_block *block, compiler_state *co
 				UML_EXHc(block, COND_NE, *m_nocode, epc(seqhead));   // exne    nocode,seqhead->pc
 			}
 #else
+		/* sum the code a dword at a time where two consecutive instructions */
+		/* share one, which halves the loads for straight-line sequences */
 		UINT32 sum = 0;
-		void *base = m_direct->read_ptr(seqhead->physpc, SH2_CODE_XOR(0));
-		UML_LOAD(block, I0, base, 0, SIZE_WORD, SCALE_x4);                              // load    i0,base,word
-		sum += seqhead->opptr.w[0];
-		for (curdesc = seqhead->next(); curdesc != seqlast->next(); curdesc = curdesc->next())
-			if (!(curdesc->flags & OPFLAG_VIRTUAL_NOOP))
+		UML_MOV(block, I0, 0);                                                          // mov     i0,0
+		for (curdesc = seqhead; curdesc != seqlast->next(); curdesc = curdesc->next())
+			if (curdesc == seqhead || !(curdesc->flags & OPFLAG_VIRTUAL_NOOP))
 			{
-				base = m_direct->read_ptr(curdesc->physpc, SH2_CODE_XOR(0));
-				UML_LOAD(block, I1, base, 0, SIZE_WORD, SCALE_x2);                      // load    i1,*opptr,word
-				UML_ADD(block, I0, I0, I1);                         // add     i0,i0,i1
-				sum += curdesc->opptr.w[0];
+				const opcode_desc *pairdesc = curdesc->next();
+				if (!(curdesc->physpc & 2) && pairdesc != seqlast->next() && !(pairdesc->flags & OPFLAG_VIRTUAL_NOOP) && pairdesc->physpc == curdesc->physpc + 2)
+				{
+					void *base = m_direct->read_ptr(curdesc->physpc);
+					UML_LOAD(block, I1, base, 0, SIZE_DWORD, SCALE_x4);                 // load    i1,base,dword
+					sum += *(UINT32 *)base;
+					curdesc = pairdesc;
+				}
+				else
+				{
+					void *base = m_direct->read_ptr(curdesc->physpc, SH2_CODE_XOR(0));
+					UML_LOAD(block, I1, base, 0, SIZE_WORD, SCALE_x2);                  // load    i1,base,word
+					sum += curdesc->opptr.w[0];
+				}
+				UML_ADD(block, I0, I0, I1);                                             // add     i0,i0,i1
 			}
 		UML_CMP(block, I0, sum);                                            // cmp     i0,sum
 		UML_EXHc(block, COND_NE, *m_nocode, epc(seqhead));           // exne    nocode,seqhead->pc
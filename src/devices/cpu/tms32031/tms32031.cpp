@@ -264,6 +264,9 @@ tms3203x_device::tms3203x_device(const machine_config &mconfig, device_type type
 		m_icount(0),
 		m_program(nullptr),
 		m_direct(nullptr),
+		m_iram(nullptr),
+		m_iram_base(~0),
+		m_iram_mask(0),
 		m_mcbl_mode(false),
 		m_xf0_cb(*this),
 		m_xf1_cb(*this),
@@ -352,6 +355,9 @@ inline UINT32 tms3203x_device::RMEM(offs_t addr)
 	if (m_mcbl_mode && addr < 0x1000)
 		return m_bootrom[addr];
 
+	if (((addr & 0xffffff) & ~m_iram_mask) == m_iram_base)
+		return m_iram[addr & m_iram_mask];
+
 	return m_program->read_dword(addr << 2);
 }
 
@@ -362,7 +368,10 @@ inline UINT32 tms3203x_device::RMEM(offs_t addr)
 
 inline void tms3203x_device::WMEM(offs_t addr, UINT32 data)
 {
-	m_program->write_dword(addr << 2, data);
+	if (((addr & 0xffffff) & ~m_iram_mask) == m_iram_base)
+		m_iram[addr & m_iram_mask] = data;
+	else
+		m_program->write_dword(addr << 2, data);
 }
 
 
@@ -444,6 +453,32 @@ void tms3203x_device::device_start()
 
 void tms3203x_device::device_reset()
 {
+	// the on-chip RAM comes from our internal map, so data accesses to it can
+	// bypass the address space; this is resolved here rather than at start so
+	// that handlers drivers install over it (e.g. idle skip hacks) are seen,
+	// and not done at all when debugging, to keep watchpoints working
+	m_iram = nullptr;
+	m_iram_base = ~0;
+	m_iram_mask = 0;
+	if ((machine().debug_flags & DEBUG_FLAG_ENABLED) == 0)
+	{
+		offs_t base = (m_chip_type == CHIP_TYPE_TMS32032) ? 0x87fe00 : 0x809800;
+		offs_t mask = (m_chip_type == CHIP_TYPE_TMS32032) ? 0x1ff : 0x7ff;
+		UINT32 *iram = reinterpret_cast<UINT32 *>(m_program->get_write_ptr(base << 2));
+
+		// every word must be plain RAM, both for reading and for writing
+		bool direct = (iram != nullptr);
+		for (offs_t offset = 0; direct && offset <= mask; offset++)
+			direct = m_program->get_read_ptr((base + offset) << 2) == iram + offset &&
+					m_program->get_write_ptr((base + offset) << 2) == iram + offset;
+		if (direct)
+		{
+			m_iram = iram;
+			m_iram_base = base;
+			m_iram_mask = mask;
+		}
+	}
+
 	m_pc = RMEM(0);
 
 	// reset some registers
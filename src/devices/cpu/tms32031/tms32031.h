@@ -769,6 +769,9 @@ protected:
 	address_space *     m_program;
 	direct_read_data *  m_direct;
 	UINT32 *            m_bootrom;
+	UINT32 *            m_iram;                 // on-chip RAM, accessed directly
+	offs_t              m_iram_base;
+	offs_t              m_iram_mask;
 
 	bool                m_mcbl_mode;
 	devcb_write8        m_xf0_cb;
@@ -1797,6 +1797,7 @@ void FUNCTION_NAME(tms340x0_device::fill)(int dst_is_linear)
 		word_write_func word_write;
 		word_read_func word_read;
 		UINT32 daddr;
+		UINT16 fillword, fillmask;
 		XY dstxy = { 0 };
 
 		/* determine read/write functions */
@@ -1853,6 +1854,18 @@ void FUNCTION_NAME(tms340x0_device::fill)(int dst_is_linear)
 		else
 			full_words /= PIXELS_PER_WORD;
 
+		/* with a plain replace op the full words don't depend on the destination: */
+		/* they get the non-transparent pixels of the fill colour */
+		fillword = COLOR1();
+		fillmask = 0xffff;
+		if (TRANSPARENCY)
+		{
+			fillmask = 0;
+			for (x = 0; x < PIXELS_PER_WORD; x++)
+				if (fillword & (PIXEL_MASK << (x * BITS_PER_PIXEL)))
+					fillmask |= PIXEL_MASK << (x * BITS_PER_PIXEL);
+		}
+
 		/* compute cycles */
 		m_gfxcycles += 2;
 		m_st |= STBIT_P;
@@ -1893,31 +1906,59 @@ void FUNCTION_NAME(tms340x0_device::fill)(int dst_is_linear)
 				(this->*word_write)(*m_program, dwordaddr++ << 1, dstword);
 			}
 
-			/* loop over full words */
-			for (words = 0; words < full_words; words++)
+			/* full words of a plain opaque fill to RAM are written directly */
+			if (!PIXEL_OP_REQUIRES_SOURCE && !TRANSPARENCY && full_words > 0 && word_write == &tms340x0_device::memory_w)
 			{
-				/* fetch the destination word (if necessary) */
-				if (PIXEL_OP_REQUIRES_SOURCE || TRANSPARENCY)
-					dstword = (this->*word_read)(*m_program, dwordaddr << 1);
+				UINT16 *dst = (UINT16 *)m_program->get_write_ptr(dwordaddr << 1);
+				if (dst != nullptr && m_program->get_write_ptr((dwordaddr + full_words - 1) << 1) == dst + full_words - 1)
+				{
+					std::fill(dst, dst + full_words, fillword);
+					dwordaddr += full_words;
+				}
 				else
-					dstword = 0;
-				dstmask = PIXEL_MASK;
-
-				/* loop over partials */
-				for (x = 0; x < PIXELS_PER_WORD; x++)
+					for (words = 0; words < full_words; words++)
+						(this->*word_write)(*m_program, dwordaddr++ << 1, fillword);
+			}
+			else if (!PIXEL_OP_REQUIRES_SOURCE)
+			{
+				/* plain replace op: merge in the precomputed fill word */
+				for (words = 0; words < full_words; words++)
 				{
-					/* process the pixel */
-					pixel = COLOR1() & dstmask;
-					PIXEL_OP(dstword, dstmask, pixel);
-					if (!TRANSPARENCY || pixel != 0)
-						dstword = (dstword & ~dstmask) | pixel;
-
-					/* update the destination */
-					dstmask = dstmask << BITS_PER_PIXEL;
+					if (TRANSPARENCY)
+						dstword = ((this->*word_read)(*m_program, dwordaddr << 1) & ~fillmask) | (fillword & fillmask);
+					else
+						dstword = fillword;
+					(this->*word_write)(*m_program, dwordaddr++ << 1, dstword);
 				}
+			}
+			else
+			{
+				/* loop over full words */
+				for (words = 0; words < full_words; words++)
+				{
+					/* fetch the destination word (if necessary) */
+					if (PIXEL_OP_REQUIRES_SOURCE || TRANSPARENCY)
+						dstword = (this->*word_read)(*m_program, dwordaddr << 1);
+					else
+						dstword = 0;
+					dstmask = PIXEL_MASK;
 
-				/* write the result */
-				(this->*word_write)(*m_program, dwordaddr++ << 1, dstword);
+					/* loop over partials */
+					for (x = 0; x < PIXELS_PER_WORD; x++)
+					{
+						/* process the pixel */
+						pixel = COLOR1() & dstmask;
+						PIXEL_OP(dstword, dstmask, pixel);
+						if (!TRANSPARENCY || pixel != 0)
+							dstword = (dstword & ~dstmask) | pixel;
+
+						/* update the destination */
+						dstmask = dstmask << BITS_PER_PIXEL;
+					}
+
+					/* write the result */
+					(this->*word_write)(*m_program, dwordaddr++ << 1, dstword);
+				}
 			}
 
 			/* handle the right partial word */
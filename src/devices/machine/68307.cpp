@@ -163,6 +163,7 @@ void m68307cpu_device::init16_m68307(address_space &space)
 	opcode_xor = 0;
 
 	readimm16 = m68k_readimm16_delegate(FUNC(m68307cpu_device::simple_read_immediate_16_m68307), this);
+	readimm16_direct = false;
 	read8 = m68k_read8_delegate(FUNC(m68307cpu_device::read_byte_m68307), this);
 	read16 = m68k_read16_delegate(FUNC(m68307cpu_device::read_word_m68307), this);
 	read32 = m68k_read32_delegate(FUNC(m68307cpu_device::read_dword_m68307), this);
@@ -913,6 +913,7 @@ void aica_device::w16(address_space &space,unsigned int addr,unsigned short val)
 		else if(addr<0x3c00)
 		{
 			*((unsigned short *) (m_DSP.MPRO+(addr-0x3400)/2))=val;
+			aica_dsp_decode(&m_DSP, (addr-0x3400)/16);
 
 			if (addr == 0x3bfe)
 			{
@@ -60,6 +60,48 @@ void aica_dsp_init(AICADSP *DSP)
 	memset(DSP,0,sizeof(AICADSP));
 	DSP->RBL=0x8000;
 	DSP->Stopped=1;
+	for(int i=0;i<128;++i)
+		aica_dsp_decode(DSP,i);
+}
+
+void aica_dsp_decode(AICADSP *DSP,int step)
+{
+	UINT16 *IPtr=DSP->MPRO+step*8;
+	AICADSP_OP *op=DSP->OPS+step;
+
+	op->TRA=(IPtr[0]>>9)&0x7F;
+	op->TWT=(IPtr[0]>>8)&0x01;
+	op->TWA=(IPtr[0]>>1)&0x7F;
+
+	op->XSEL=(IPtr[2]>>15)&0x01;
+	op->YSEL=(IPtr[2]>>13)&0x03;
+	op->IRA=(IPtr[2]>>7)&0x3F;
+	op->IWT=(IPtr[2]>>6)&0x01;
+	op->IWA=(IPtr[2]>>1)&0x1F;
+
+	op->TABLE=(IPtr[4]>>15)&0x01;
+	op->MWT=(IPtr[4]>>14)&0x01;
+	op->MRD=(IPtr[4]>>13)&0x01;
+	op->EWT=(IPtr[4]>>12)&0x01;
+	op->EWA=(IPtr[4]>>8)&0x0F;
+	op->ADRL=(IPtr[4]>>7)&0x01;
+	op->FRCL=(IPtr[4]>>6)&0x01;
+	op->SHIFT=(IPtr[4]>>4)&0x03;
+	op->YRL=(IPtr[4]>>3)&0x01;
+	op->NEGB=(IPtr[4]>>2)&0x01;
+	op->ZERO=(IPtr[4]>>1)&0x01;
+	op->BSEL=(IPtr[4]>>0)&0x01;
+
+	op->NOFL=(IPtr[6]>>15)&1;        //????
+	op->COEF=step;
+
+	op->MASA=(IPtr[6]>>9)&0x1f;  //???
+	op->ADREB=(IPtr[6]>>8)&0x1;
+	op->NXADR=(IPtr[6]>>7)&0x1;
+
+	//memory only allowed on odd? DoA inserts NOPs on even
+	if(!(step&1))
+		op->MRD=op->MWT=0;
 }
 
 void aica_dsp_step(AICADSP *DSP)
@@ -89,40 +131,37 @@ void aica_dsp_step(AICADSP *DSP)
 #endif
 	for(step=0;step</*128*/DSP->LastStep;++step)
 	{
-		UINT16 *IPtr=DSP->MPRO+step*8;
-
-//      if(IPtr[0]==0 && IPtr[1]==0 && IPtr[2]==0 && IPtr[3]==0)
-//          break;
-
-		UINT32 TRA=(IPtr[0]>>9)&0x7F;
-		UINT32 TWT=(IPtr[0]>>8)&0x01;
-		UINT32 TWA=(IPtr[0]>>1)&0x7F;
-
-		UINT32 XSEL=(IPtr[2]>>15)&0x01;
-		UINT32 YSEL=(IPtr[2]>>13)&0x03;
-		UINT32 IRA=(IPtr[2]>>7)&0x3F;
-		UINT32 IWT=(IPtr[2]>>6)&0x01;
-		UINT32 IWA=(IPtr[2]>>1)&0x1F;
-
-		UINT32 TABLE=(IPtr[4]>>15)&0x01;
-		UINT32 MWT=(IPtr[4]>>14)&0x01;
-		UINT32 MRD=(IPtr[4]>>13)&0x01;
-		UINT32 EWT=(IPtr[4]>>12)&0x01;
-		UINT32 EWA=(IPtr[4]>>8)&0x0F;
-		UINT32 ADRL=(IPtr[4]>>7)&0x01;
-		UINT32 FRCL=(IPtr[4]>>6)&0x01;
-		UINT32 SHIFT=(IPtr[4]>>4)&0x03;
-		UINT32 YRL=(IPtr[4]>>3)&0x01;
-		UINT32 NEGB=(IPtr[4]>>2)&0x01;
-		UINT32 ZERO=(IPtr[4]>>1)&0x01;
-		UINT32 BSEL=(IPtr[4]>>0)&0x01;
-
-		UINT32 NOFL=(IPtr[6]>>15)&1;        //????
-		UINT32 COEF=step;
-
-		UINT32 MASA=(IPtr[6]>>9)&0x1f;  //???
-		UINT32 ADREB=(IPtr[6]>>8)&0x1;
-		UINT32 NXADR=(IPtr[6]>>7)&0x1;
+		const AICADSP_OP *op=DSP->OPS+step;
+
+		UINT32 TRA=op->TRA;
+		UINT32 TWT=op->TWT;
+		UINT32 TWA=op->TWA;
+
+		UINT32 XSEL=op->XSEL;
+		UINT32 YSEL=op->YSEL;
+		UINT32 IRA=op->IRA;
+		UINT32 IWT=op->IWT;
+		UINT32 IWA=op->IWA;
+
+		UINT32 TABLE=op->TABLE;
+		UINT32 MWT=op->MWT;
+		UINT32 MRD=op->MRD;
+		UINT32 EWT=op->EWT;
+		UINT32 EWA=op->EWA;
+		UINT32 ADRL=op->ADRL;
+		UINT32 FRCL=op->FRCL;
+		UINT32 SHIFT=op->SHIFT;
+		UINT32 YRL=op->YRL;
+		UINT32 NEGB=op->NEGB;
+		UINT32 ZERO=op->ZERO;
+		UINT32 BSEL=op->BSEL;
+
+		UINT32 NOFL=op->NOFL;
+		UINT32 COEF=op->COEF;
+
+		UINT32 MASA=op->MASA;
+		UINT32 ADREB=op->ADREB;
+		UINT32 NXADR=op->NXADR;
 
 		INT64 v;
 
@@ -294,14 +333,14 @@ void aica_dsp_step(AICADSP *DSP)
 			//ADDR+=DSP->RBP<<13;
 			//MEMVAL=DSP->AICARAM[ADDR>>1];
 			ADDR+=DSP->RBP<<10;
-			if(MRD && (step&1)) //memory only allowed on odd? DoA inserts NOPs on even
+			if(MRD)
 			{
 				if(NOFL)
 					MEMVAL=DSP->AICARAM[ADDR]<<8;
 				else
 					MEMVAL=UNPACK(DSP->AICARAM[ADDR]);
 			}
-			if(MWT && (step&1))
+			if(MWT)
 			{
 				if(NOFL)
 					DSP->AICARAM[ADDR]=SHIFTED>>8;
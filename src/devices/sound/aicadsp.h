@@ -5,6 +5,15 @@
 #ifndef __AICADSP_H__
 #define __AICADSP_H__
 
+//a pre-decoded microprogram step
+struct AICADSP_OP
+{
+	UINT8 TRA, TWT, TWA;
+	UINT8 XSEL, YSEL, IRA, IWT, IWA;
+	UINT8 TABLE, MWT, MRD, EWT, EWA, ADRL, FRCL, SHIFT, YRL, NEGB, ZERO, BSEL;
+	UINT8 NOFL, COEF, MASA, ADREB, NXADR;
+};
+
 //the DSP Context
 struct AICADSP
 {
@@ -32,11 +41,15 @@ struct AICADSP
 
 	int Stopped;
 	int LastStep;
+
+//MPRO decoded into fields, kept in sync on every MPRO write
+	AICADSP_OP OPS[128];
 };
 
 void aica_dsp_init(AICADSP *DSP);
 void aica_dsp_setsample(AICADSP *DSP, INT32 sample, INT32 SEL, INT32 MXL);
 void aica_dsp_step(AICADSP *DSP);
+void aica_dsp_decode(AICADSP *DSP, int step);
 void aica_dsp_start(AICADSP *DSP);
 
 #endif /* __AICADSP_H__ */
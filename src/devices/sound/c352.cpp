@@ -329,9 +329,11 @@ void c352_device::sound_stream_update(sound_stream &stream, stream_sample_t **in
 			m_channel_l[i] = m_channel_r[i] = m_channel_l2[i] = m_channel_r2[i] = 0;
 	}
 
+	bool busy = false;
 	for (j = 0 ; j < 32 ; j++)
 	{
 		mix_one_channel(j, samples);
+		busy |= (m_c352_ch[j].flag & C352_FLG_BUSY) != 0;
 	}
 
 	for(i = 0 ; i < samples ; i++)
@@ -341,6 +343,9 @@ void c352_device::sound_stream_update(sound_stream &stream, stream_sample_t **in
 		*bufferl2++ = (short) (m_channel_l2[i] >>3);
 		*bufferr2++ = (short) (m_channel_r2[i] >>3);
 	}
+
+	// nothing to generate until a channel is keyed on again
+	stream.set_idle(!busy);
 }
 
 unsigned short c352_device::read_reg16(unsigned long address)
@@ -396,6 +401,7 @@ void c352_device::write_reg16(unsigned long address, unsigned short val)
 							m_c352_ch[i].noisecnt = 0;
 							m_c352_ch[i].flag &= ~(C352_FLG_KEYON | C352_FLG_LOOPHIST);
 							m_c352_ch[i].flag |= C352_FLG_BUSY;
+							m_stream->set_idle(false);
 						}
 					}
 					else if ( m_c352_ch[i].flag & C352_FLG_KEYOFF )
@@ -442,6 +448,8 @@ void c352_device::write_reg16(unsigned long address, unsigned short val)
 		// flags
 		LOG(("CH %02ld FLAG %02x\n", chan, val));
 		m_c352_ch[chan].flag = val;
+		if (val & C352_FLG_BUSY)
+			m_stream->set_idle(false);
 		break;
 
 	case 0x8:
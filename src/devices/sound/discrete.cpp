@@ -88,18 +88,22 @@ const device_type DISCRETE = &device_creator<discrete_sound_device>;
  *
  *************************************/
 
+class discrete_task;
+
+/* single producer buffer: written by the owning task only, readers follow its produced count */
 struct output_buffer
 {
 	double                      *node_buf;
 	const double                *source;
-	volatile double             *ptr;
+	double                      *ptr;
 	int                         node_num;
 };
 
 struct input_buffer
 {
-	volatile const double       *ptr;               /* pointer into linked_outbuf.nodebuf */
+	const double                *ptr;               /* pointer into linked_outbuf.nodebuf */
 	output_buffer *             linked_outbuf;      /* what output are we connected to ? */
+	discrete_task *             linked_task;        /* task producing linked_outbuf */
 	double                      buffer;             /* input[] will point here */
 };
 
@@ -110,12 +114,13 @@ public:
 	virtual ~discrete_task(void) { }
 
 	inline void step_nodes(void);
-	inline bool lock_threadid(INT32 threadid)
+
+	/* queue the task unless it is already queued or running */
+	inline void schedule(void)
 	{
-		int expected = -1;
-		return m_threadid.compare_exchange_weak(expected, threadid, std::memory_order_release,std::memory_order_relaxed);
+		if (!m_scheduled.exchange(true))
+			osd_work_item_queue(m_device.m_queue, task_callback, (void *) this, WORK_ITEM_FLAG_AUTO_RELEASE);
 	}
-	inline void unlock(void) { m_threadid = -1; }
 
 	//const linked_list_entry *list;
 	node_step_list_t        step_list;
@@ -127,26 +132,30 @@ public:
 
 
 	discrete_task(discrete_device &pdev)
-	: task_group(0), m_device(pdev), m_threadid(-1), m_samples(0)
+	: task_group(0), m_device(pdev), m_scheduled(false), m_produced(0), m_samples(0)
 {
 		source_list.clear();
 		step_list.clear();
 		m_buffers.clear();
+		m_dependents.clear();
 	}
 
 protected:
 	static void *task_callback(void *param, int threadid);
-	inline bool process(void);
+	inline int available(const discrete_task *&blocker, INT32 &consumed);
+	void process(void);
 
 	void check(discrete_task *dest_task);
 	void prepare_for_queue(int samples);
 
 	vector_t<output_buffer>      m_buffers;
+	vector_t<discrete_task *>    m_dependents;      /* tasks reading our buffers */
 	discrete_device &                   m_device;
 
 private:
-	std::atomic<INT32>      m_threadid;
-	volatile int            m_samples;
+	std::atomic<bool>       m_scheduled;            /* queued or running on a worker */
+	std::atomic<INT32>      m_produced;             /* samples in our buffers so far */
+	int                     m_samples;              /* samples left to produce, owned by the running worker */
 
 };
 
@@ -215,58 +224,78 @@ inline void discrete_task::step_nodes(void)
 
 void *discrete_task::task_callback(void *param, int threadid)
 {
-	task_list_t *list = (task_list_t *) param;
-	do
-	{
-		for_each(discrete_task **, task, list)
-		{
-			/* try to lock */
-			if ((*task)->lock_threadid(threadid))
-			{
-				if (!(*task)->process())
-					return nullptr;
-				(*task)->unlock();
-			}
-		}
-	} while (1);
-
+	discrete_task *task = (discrete_task *) param;
+	task->process();
 	return nullptr;
 }
 
-bool discrete_task::process(void)
+/* number of samples we can produce with the input currently buffered;
+   if we are starved of input, also report whose output we are waiting for
+   and how much of it we have consumed */
+inline int discrete_task::available(const discrete_task *&blocker, INT32 &consumed)
 {
 	int samples = MIN(m_samples, MAX_SAMPLES_PER_TASK_SLICE);
 
+	blocker = nullptr;
+	consumed = 0;
+
 	/* check dependencies */
 	for_each(input_buffer *, sn, &source_list)
 	{
 		int avail;
 
-		avail = sn->linked_outbuf->ptr - sn->ptr;
+		if (samples == 0)
+			break;
+		consumed = sn->ptr - sn->linked_outbuf->node_buf;
+		avail = sn->linked_task->m_produced - consumed;
 		assert_always(avail >= 0, "task_callback: available samples are negative");
 		if (avail < samples)
 			samples = avail;
+		if (samples == 0)
+			blocker = sn->linked_task;
 	}
+	return samples;
+}
 
-	m_samples -= samples;
-	assert_always(m_samples >=0, "task_callback: task_samples got negative");
-	while (samples > 0)
-	{
-		/* step */
-		step_nodes();
-		samples--;
-	}
-	if (m_samples == 0)
+void discrete_task::process(void)
+{
+	do
 	{
-		/* return and keep the task locked so it is not picked up by other worker threads */
-		return false;
-	}
-	return true;
+		const discrete_task *blocker;
+		INT32 consumed;
+		int samples;
+
+		/* run for as long as our inputs allow */
+		while ((samples = available(blocker, consumed)) > 0)
+		{
+			m_samples -= samples;
+			assert_always(m_samples >=0, "task_callback: task_samples got negative");
+			for (int i = 0; i < samples; i++)
+			{
+				/* step */
+				step_nodes();
+			}
+
+			/* publish the new samples and wake up whoever waits for them */
+			m_produced += samples;
+			for_each(discrete_task **, dest_task, &m_dependents)
+				(*dest_task)->schedule();
+		}
+
+		/* either done or waiting for input; a producer publishing between our check above
+		   and clearing the flag would not have queued us, so look again afterwards - but
+		   another worker may own the task as soon as the flag is clear, so only the
+		   producer's atomic count can be looked at */
+		m_scheduled = false;
+		if (blocker == nullptr || blocker->m_produced == consumed)
+			return;
+	} while (!m_scheduled.exchange(true));
 }
 
 void discrete_task::prepare_for_queue(int samples)
 {
 	m_samples = samples;
+	m_produced = 0;
 	/* set up task buffers */
 	for_each(output_buffer *, ob, &m_buffers)
 		ob->ptr = ob->node_buf;
@@ -335,10 +364,18 @@ void discrete_task::check(discrete_task *dest_task)
 						//source.task = this;
 						//source.output_node = i;
 						source.linked_outbuf = pbuf;
+						source.linked_task = this;
 						source.buffer = 0.0; /* please compiler */
 						source.ptr = nullptr;
 						dest_task->source_list.add(source);
 
+						/* dest_task needs waking up whenever we produced new samples */
+						for (i = 0; i < m_dependents.count(); i++)
+							if (m_dependents[i] == dest_task)
+								break;
+						if (i == m_dependents.count())
+							m_dependents.add(dest_task);
+
 						/* point the input to a buffered location */
 						dest_node->m_input[inputnum] = &dest_task->source_list[dest_task->source_list.count()-1].buffer; // was copied!   &source.buffer;
 
@@ -1044,18 +1081,14 @@ void discrete_device::process(int samples)
 
 	/* Setup tasks */
 	for_each(discrete_task **, task, &task_list)
-	{
-		/* unlock the thread */
-		(*task)->unlock();
-
 		(*task)->prepare_for_queue(samples);
-	}
 
+	/* Start the tasks without inputs; the others are queued by their
+	 * source tasks once there are samples for them to process
+	 */
 	for_each(discrete_task **, task, &task_list)
-	{
-		/* Fire a work item for each task */
-		osd_work_item_queue(m_queue, discrete_task::task_callback, (void *) &task_list, WORK_ITEM_FLAG_AUTO_RELEASE);
-	}
+		if ((*task)->source_list.count() == 0)
+			(*task)->schedule();
 	osd_work_queue_wait(m_queue, osd_ticks_per_second()*10);
 
 	if (m_profiling)
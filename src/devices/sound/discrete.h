@@ -4279,6 +4279,7 @@ typedef vector_t<discrete_sound_output_interface *> node_output_list_t;
 class discrete_device : public device_t
 {
 	//friend class discrete_base_node;
+	friend class discrete_task;
 
 protected:
 	// construction/destruction
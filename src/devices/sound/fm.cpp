@@ -1344,6 +1344,38 @@ static inline void update_phase_lfo_channel(FM_OPN *OPN, FM_CH *CH)
 	}
 }
 
+/* update phase counters of a channel */
+static inline void chan_update_phase(FM_OPN *OPN, FM_CH *CH, int chnum)
+{
+	if(CH->pms)
+	{
+		/* add support for 3 slot mode */
+		if ((OPN->ST.mode & 0xC0) && (chnum == 2))
+		{
+				update_phase_lfo_slot(OPN, &CH->SLOT[SLOT1], CH->pms, OPN->SL3.block_fnum[1]);
+				update_phase_lfo_slot(OPN, &CH->SLOT[SLOT2], CH->pms, OPN->SL3.block_fnum[2]);
+				update_phase_lfo_slot(OPN, &CH->SLOT[SLOT3], CH->pms, OPN->SL3.block_fnum[0]);
+				update_phase_lfo_slot(OPN, &CH->SLOT[SLOT4], CH->pms, CH->block_fnum);
+		}
+		else update_phase_lfo_channel(OPN, CH);
+	}
+	else    /* no LFO phase modulation */
+	{
+		CH->SLOT[SLOT1].phase += CH->SLOT[SLOT1].Incr;
+		CH->SLOT[SLOT2].phase += CH->SLOT[SLOT2].Incr;
+		CH->SLOT[SLOT3].phase += CH->SLOT[SLOT3].Incr;
+		CH->SLOT[SLOT4].phase += CH->SLOT[SLOT4].Incr;
+	}
+}
+
+/* all operators below the audible level and nothing left in the feedback and MEM delays */
+static inline int chan_silent(FM_CH *CH)
+{
+	return CH->SLOT[SLOT1].vol_out >= ENV_QUIET && CH->SLOT[SLOT2].vol_out >= ENV_QUIET &&
+			CH->SLOT[SLOT3].vol_out >= ENV_QUIET && CH->SLOT[SLOT4].vol_out >= ENV_QUIET &&
+			!CH->op1_out[0] && !CH->op1_out[1] && !CH->mem_value;
+}
+
 static inline void chan_calc(FM_OPN *OPN, FM_CH *CH, int chnum)
 {
 	unsigned int eg_out;
@@ -1353,6 +1385,13 @@ static inline void chan_calc(FM_OPN *OPN, FM_CH *CH, int chnum)
 
 	OPN->m2 = OPN->c1 = OPN->c2 = OPN->mem = 0;
 
+	/* a silent channel adds nothing to the mix, only its phase counters move on */
+	if (chan_silent(CH))
+	{
+		chan_update_phase(OPN, CH, chnum);
+		return;
+	}
+
 	*CH->mem_connect = CH->mem_value;   /* restore delayed sample (MEM) value to m2 or c2 */
 
 	eg_out = volume_calc(&CH->SLOT[SLOT1]);
@@ -1398,25 +1437,7 @@ static inline void chan_calc(FM_OPN *OPN, FM_CH *CH, int chnum)
 	CH->mem_value = OPN->mem;
 
 	/* update phase counters AFTER output calculations */
-	if(CH->pms)
-	{
-		/* add support for 3 slot mode */
-		if ((OPN->ST.mode & 0xC0) && (chnum == 2))
-		{
-				update_phase_lfo_slot(OPN, &CH->SLOT[SLOT1], CH->pms, OPN->SL3.block_fnum[1]);
-				update_phase_lfo_slot(OPN, &CH->SLOT[SLOT2], CH->pms, OPN->SL3.block_fnum[2]);
-				update_phase_lfo_slot(OPN, &CH->SLOT[SLOT3], CH->pms, OPN->SL3.block_fnum[0]);
-				update_phase_lfo_slot(OPN, &CH->SLOT[SLOT4], CH->pms, CH->block_fnum);
-		}
-		else update_phase_lfo_channel(OPN, CH);
-	}
-	else    /* no LFO phase modulation */
-	{
-		CH->SLOT[SLOT1].phase += CH->SLOT[SLOT1].Incr;
-		CH->SLOT[SLOT2].phase += CH->SLOT[SLOT2].Incr;
-		CH->SLOT[SLOT3].phase += CH->SLOT[SLOT3].Incr;
-		CH->SLOT[SLOT4].phase += CH->SLOT[SLOT4].Incr;
-	}
+	chan_update_phase(OPN, CH, chnum);
 }
 
 /* update phase increment and envelope generator */
@@ -913,6 +913,14 @@ static inline signed int op_calc1(UINT32 phase, unsigned int env, signed int pm,
 
 #define volume_calc(OP) ((OP)->TLL + ((UINT32)(OP)->volume) + (OPL->LFO_AM & (OP)->AMmask))
 
+/* both operators below the audible level (before AM) and nothing left in the feedback delay */
+static inline int OPL_CH_SILENT( OPL_CH *CH )
+{
+	return CH->SLOT[SLOT1].TLL + (UINT32)CH->SLOT[SLOT1].volume >= ENV_QUIET &&
+			CH->SLOT[SLOT2].TLL + (UINT32)CH->SLOT[SLOT2].volume >= ENV_QUIET &&
+			!CH->SLOT[SLOT1].op1_out[0] && !CH->SLOT[SLOT1].op1_out[1];
+}
+
 /* calculate output */
 static inline void OPL_CALC_CH( FM_OPL *OPL, OPL_CH *CH )
 {
@@ -922,6 +930,10 @@ static inline void OPL_CALC_CH( FM_OPL *OPL, OPL_CH *CH )
 
 	OPL->phase_modulation = 0;
 
+	/* a silent channel adds nothing to the mix (phases are advanced separately) */
+	if (OPL_CH_SILENT(CH))
+		return;
+
 	/* SLOT 1 */
 	SLOT = &CH->SLOT[SLOT1];
 	env  = volume_calc(SLOT);
@@ -343,6 +343,7 @@ void multipcm_device::write_slot(slot_t *slot, INT32 reg, UINT8 data)
 			{
 				slot->m_sample = m_samples + slot->m_regs[1];
 				slot->m_playing = true;
+				m_stream->set_idle(false);
 				slot->m_base = slot->m_sample->m_start;
 				slot->m_offset = 0;
 				slot->m_prev_sample = 0;
@@ -753,4 +754,10 @@ void multipcm_device::sound_stream_update(sound_stream &stream, stream_sample_t
 		datap[0][i] = clamp_to_int16(smpl);
 		datap[1][i] = clamp_to_int16(smpr);
 	}
+
+	// nothing to generate until the next key on
+	bool playing = false;
+	for (INT32 sl = 0; sl < 28; ++sl)
+		playing |= m_slots[sl].m_playing;
+	stream.set_idle(!playing);
 }
@@ -201,8 +201,15 @@ void okim6295_device::sound_stream_update(sound_stream &stream, stream_sample_t
 	memset(outputs[0], 0, samples * sizeof(*outputs[0]));
 
 	// iterate over voices and accumulate sample data
+	bool playing = false;
 	for (auto & elem : m_voice)
+	{
 		elem.generate_adpcm(*m_direct, outputs[0], samples);
+		playing |= elem.m_playing;
+	}
+
+	// nothing to generate until the next voice is started
+	stream.set_idle(!playing);
 }
 
 
@@ -325,6 +332,7 @@ void okim6295_device::write_command(UINT8 command)
 						// also reset the ADPCM parameters
 						voice.m_adpcm.reset();
 						voice.m_volume = s_volume_table[command & 0x0f];
+						m_stream->set_idle(false);
 					}
 
 					// invalid samples go here
@@ -59,6 +59,48 @@ void SCSPDSP_Init(SCSPDSP *DSP)
 	memset(DSP,0,sizeof(SCSPDSP));
 	DSP->RBL=0x8000;
 	DSP->Stopped=1;
+	for(int i=0;i<128;++i)
+		SCSPDSP_Decode(DSP,i);
+}
+
+void SCSPDSP_Decode(SCSPDSP *DSP,int step)
+{
+	UINT16 *IPtr=DSP->MPRO+step*4;
+	SCSPDSP_OP *op=DSP->OPS+step;
+
+	op->TRA=(IPtr[0]>>8)&0x7F;
+	op->TWT=(IPtr[0]>>7)&0x01;
+	op->TWA=(IPtr[0]>>0)&0x7F;
+
+	op->XSEL=(IPtr[1]>>15)&0x01;
+	op->YSEL=(IPtr[1]>>13)&0x03;
+	op->IRA=(IPtr[1]>>6)&0x3F;
+	op->IWT=(IPtr[1]>>5)&0x01;
+	op->IWA=(IPtr[1]>>0)&0x1F;
+
+	op->TABLE=(IPtr[2]>>15)&0x01;
+	op->MWT=(IPtr[2]>>14)&0x01;
+	op->MRD=(IPtr[2]>>13)&0x01;
+	op->EWT=(IPtr[2]>>12)&0x01;
+	op->EWA=(IPtr[2]>>8)&0x0F;
+	op->ADRL=(IPtr[2]>>7)&0x01;
+	op->FRCL=(IPtr[2]>>6)&0x01;
+	op->SHIFT=(IPtr[2]>>4)&0x03;
+	op->YRL=(IPtr[2]>>3)&0x01;
+	op->NEGB=(IPtr[2]>>2)&0x01;
+	op->ZERO=(IPtr[2]>>1)&0x01;
+	op->BSEL=(IPtr[2]>>0)&0x01;
+
+	op->NOFL=(IPtr[3]>>15)&1;        //????
+	op->COEF=(IPtr[3]>>9)&0x3f;
+
+	op->MASA=(IPtr[3]>>2)&0x1f;  //???
+	op->ADREB=(IPtr[3]>>1)&0x1;
+	op->NXADR=(IPtr[3]>>0)&0x1;
+
+	//memory only allowed on odd? DoA inserts NOPs on even
+	if(!(step&1))
+		op->MRD=op->MWT=0;
 }
 
 void SCSPDSP_Step(SCSPDSP *DSP)
@@ -88,40 +130,37 @@ void SCSPDSP_Step(SCSPDSP *DSP)
 #endif
 	for(step=0;step</*128*/DSP->LastStep;++step)
 	{
-		UINT16 *IPtr=DSP->MPRO+step*4;
-
-//      if(IPtr[0]==0 && IPtr[1]==0 && IPtr[2]==0 && IPtr[3]==0)
-//          break;
-
-		UINT32 TRA=(IPtr[0]>>8)&0x7F;
-		UINT32 TWT=(IPtr[0]>>7)&0x01;
-		UINT32 TWA=(IPtr[0]>>0)&0x7F;
-
-		UINT32 XSEL=(IPtr[1]>>15)&0x01;
-		UINT32 YSEL=(IPtr[1]>>13)&0x03;
-		UINT32 IRA=(IPtr[1]>>6)&0x3F;
-		UINT32 IWT=(IPtr[1]>>5)&0x01;
-		UINT32 IWA=(IPtr[1]>>0)&0x1F;
-
-		UINT32 TABLE=(IPtr[2]>>15)&0x01;
-		UINT32 MWT=(IPtr[2]>>14)&0x01;
-		UINT32 MRD=(IPtr[2]>>13)&0x01;
-		UINT32 EWT=(IPtr[2]>>12)&0x01;
-		UINT32 EWA=(IPtr[2]>>8)&0x0F;
-		UINT32 ADRL=(IPtr[2]>>7)&0x01;
-		UINT32 FRCL=(IPtr[2]>>6)&0x01;
-		UINT32 SHIFT=(IPtr[2]>>4)&0x03;
-		UINT32 YRL=(IPtr[2]>>3)&0x01;
-		UINT32 NEGB=(IPtr[2]>>2)&0x01;
-		UINT32 ZERO=(IPtr[2]>>1)&0x01;
-		UINT32 BSEL=(IPtr[2]>>0)&0x01;
-
-		UINT32 NOFL=(IPtr[3]>>15)&1;        //????
-		UINT32 COEF=(IPtr[3]>>9)&0x3f;
-
-		UINT32 MASA=(IPtr[3]>>2)&0x1f;  //???
-		UINT32 ADREB=(IPtr[3]>>1)&0x1;
-		UINT32 NXADR=(IPtr[3]>>0)&0x1;
+		const SCSPDSP_OP *op=DSP->OPS+step;
+
+		UINT32 TRA=op->TRA;
+		UINT32 TWT=op->TWT;
+		UINT32 TWA=op->TWA;
+
+		UINT32 XSEL=op->XSEL;
+		UINT32 YSEL=op->YSEL;
+		UINT32 IRA=op->IRA;
+		UINT32 IWT=op->IWT;
+		UINT32 IWA=op->IWA;
+
+		UINT32 TABLE=op->TABLE;
+		UINT32 MWT=op->MWT;
+		UINT32 MRD=op->MRD;
+		UINT32 EWT=op->EWT;
+		UINT32 EWA=op->EWA;
+		UINT32 ADRL=op->ADRL;
+		UINT32 FRCL=op->FRCL;
+		UINT32 SHIFT=op->SHIFT;
+		UINT32 YRL=op->YRL;
+		UINT32 NEGB=op->NEGB;
+		UINT32 ZERO=op->ZERO;
+		UINT32 BSEL=op->BSEL;
+
+		UINT32 NOFL=op->NOFL;
+		UINT32 COEF=op->COEF;
+
+		UINT32 MASA=op->MASA;
+		UINT32 ADREB=op->ADREB;
+		UINT32 NXADR=op->NXADR;
 
 		INT64 v;
 
@@ -297,14 +336,14 @@ void SCSPDSP_Step(SCSPDSP *DSP)
 			//MEMVAL=DSP->SCSPRAM[ADDR>>1];
 			ADDR+=DSP->RBP<<12;
 			if (ADDR > 0x7ffff) ADDR = 0;
-			if(MRD && (step&1)) //memory only allowed on odd? DoA inserts NOPs on even
+			if(MRD)
 			{
 				if(NOFL)
 					MEMVAL=DSP->SCSPRAM[ADDR]<<8;
 				else
 					MEMVAL=UNPACK(DSP->SCSPRAM[ADDR]);
 			}
-			if(MWT && (step&1))
+			if(MWT)
 			{
 				if(NOFL)
 						DSP->SCSPRAM[ADDR]=SHIFTED>>8;
@@ -5,6 +5,15 @@
 #ifndef __SCSPDSP_H__
 #define __SCSPDSP_H__
 
+//a pre-decoded microprogram step
+struct SCSPDSP_OP
+{
+	UINT8 TRA, TWT, TWA;
+	UINT8 XSEL, YSEL, IRA, IWT, IWA;
+	UINT8 TABLE, MWT, MRD, EWT, EWA, ADRL, FRCL, SHIFT, YRL, NEGB, ZERO, BSEL;
+	UINT8 NOFL, COEF, MASA, ADREB, NXADR;
+};
+
 //the DSP Context
 struct SCSPDSP
 {
@@ -32,11 +41,15 @@ struct SCSPDSP
 
 	int Stopped;
 	int LastStep;
+
+//MPRO decoded into fields, kept in sync on every MPRO write
+	SCSPDSP_OP OPS[128];
 };
 
 void SCSPDSP_Init(SCSPDSP *DSP);
 void SCSPDSP_SetSample(SCSPDSP *DSP, INT32 sample, INT32 SEL, INT32 MXL);
 void SCSPDSP_Step(SCSPDSP *DSP);
+void SCSPDSP_Decode(SCSPDSP *DSP, int step);
 void SCSPDSP_Start(SCSPDSP *DSP);
 
 #endif /* __SCSPDSP_H__ */
@@ -1687,6 +1687,14 @@ static inline signed int op_calc1(YM2151Operator * OP, unsigned int env, signed
 
 #define volume_calc(OP) ((OP)->tl + ((UINT32)(OP)->volume) + (AM & (OP)->AMmask))
 
+/* all operators below the audible level (before AM) and nothing left in the feedback and MEM delays */
+static inline int chan_silent(YM2151Operator *op)
+{
+	return op[0].tl + (UINT32)op[0].volume >= ENV_QUIET && op[1].tl + (UINT32)op[1].volume >= ENV_QUIET &&
+			op[2].tl + (UINT32)op[2].volume >= ENV_QUIET && op[3].tl + (UINT32)op[3].volume >= ENV_QUIET &&
+			!op->fb_out_prev && !op->fb_out_curr && !op->mem_value;
+}
+
 static inline void chan_calc(YM2151 *PSG, unsigned int chan)
 {
 	YM2151Operator *op;
@@ -1696,6 +1704,10 @@ static inline void chan_calc(YM2151 *PSG, unsigned int chan)
 	PSG->m2 = PSG->c1 = PSG->c2 = PSG->mem = 0;
 	op = &PSG->oper[chan*4];    /* M1 */
 
+	/* a silent channel adds nothing to the mix (phases are advanced separately) */
+	if (chan_silent(op))
+		return;
+
 	*op->mem_connect = op->mem_value;   /* restore delayed sample (MEM) value to m2 or c2 */
 
 	if (op->ams)
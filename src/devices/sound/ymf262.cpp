@@ -876,6 +876,13 @@ static inline signed int op_calc1(UINT32 phase, unsigned int env, signed int pm,
 
 #define volume_calc(OP) ((OP)->TLL + ((UINT32)(OP)->volume) + (chip->LFO_AM & (OP)->AMmask))
 
+/* both operators below the audible level (before AM) */
+static inline int slots_silent( OPL3_CH *CH )
+{
+	return CH->SLOT[SLOT1].TLL + (UINT32)CH->SLOT[SLOT1].volume >= ENV_QUIET &&
+			CH->SLOT[SLOT2].TLL + (UINT32)CH->SLOT[SLOT2].volume >= ENV_QUIET;
+}
+
 /* calculate output of a standard 2 operator channel
  (or 1st part of a 4-op channel) */
 static inline void chan_calc( OPL3 *chip, OPL3_CH *CH )
@@ -887,6 +894,10 @@ static inline void chan_calc( OPL3 *chip, OPL3_CH *CH )
 	chip->phase_modulation = 0;
 	chip->phase_modulation2= 0;
 
+	/* a silent channel adds nothing to the mix (phases are advanced separately) */
+	if (slots_silent(CH) && !CH->SLOT[SLOT1].op1_out[0] && !CH->SLOT[SLOT1].op1_out[1])
+		return;
+
 	/* SLOT 1 */
 	SLOT = &CH->SLOT[SLOT1];
 	env  = volume_calc(SLOT);
@@ -920,6 +931,9 @@ static inline void chan_calc_ext( OPL3 *chip, OPL3_CH *CH )
 
 	chip->phase_modulation = 0;
 
+	if (slots_silent(CH))
+		return;
+
 	/* SLOT 1 */
 	SLOT = &CH->SLOT[SLOT1];
 	env  = volume_calc(SLOT);
@@ -439,6 +439,7 @@ void ymz280b_device::sound_stream_update(sound_stream &stream, stream_sample_t *
 {
 	stream_sample_t *lacc = outputs[0];
 	stream_sample_t *racc = outputs[1];
+	bool idle = true;
 	int v;
 
 	/* clear out the accumulator */
@@ -468,6 +469,7 @@ void ymz280b_device::sound_stream_update(sound_stream &stream, stream_sample_t *
 
 			continue;
 		}
+		idle = false;
 
 		/* finish off the current sample */
 		/* interpolate */
@@ -563,6 +565,9 @@ void ymz280b_device::sound_stream_update(sound_stream &stream, stream_sample_t *
 		outputs[0][v] /= 256;
 		outputs[1][v] /= 256;
 	}
+
+	/* nothing to generate until the next key on */
+	stream.set_idle(idle);
 }
 
 
@@ -936,6 +941,11 @@ WRITE8_MEMBER( ymz280b_device::write )
 		m_stream->update();
 
 		write_to_register(data);
+
+		/* wake the stream up if this started a voice */
+		for (auto & elem : m_voice)
+			if (elem.playing)
+				m_stream->set_idle(false);
 	}
 }
 
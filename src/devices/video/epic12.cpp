@@ -12,7 +12,7 @@ const device_type EPIC12 = &device_creator<epic12_device>;
 epic12_device::epic12_device(const machine_config &mconfig, const char *tag, device_t *owner, UINT32 clock)
 	: device_t(mconfig, EPIC12, "EP1C12 Blitter", tag, owner, clock, "epic12", __FILE__),
 		device_video_interface(mconfig, *this), m_ram16(nullptr), m_gfx_size(0), m_bitmaps(nullptr), m_use_ram(nullptr),
-	m_main_ramsize(0), m_main_rammask(0), m_maincpu(nullptr), m_ram16_copy(nullptr), m_work_queue(nullptr)
+	m_main_ramsize(0), m_main_rammask(0), m_maincpu(nullptr), m_ram16_copy(nullptr), m_work_queue(nullptr), m_split_queue(nullptr)
 {
 	m_is_unsafe = 0;
 	m_delay_scale = 0;
@@ -50,6 +50,8 @@ void epic12_device::device_start()
 	m_blitter_delay_timer = machine().scheduler().timer_alloc(timer_expired_delegate(FUNC(epic12_device::blitter_delay_callback),this));
 	m_blitter_delay_timer->adjust(attotime::never);
 
+	m_split_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_HIGH_FREQ|WORK_QUEUE_FLAG_MULTI);
+
 	save_item(NAME(m_gfx_addr));
 	save_item(NAME(m_gfx_scroll_0_x));
 	save_item(NAME(m_gfx_scroll_0_y));
@@ -65,6 +67,18 @@ void epic12_device::device_start()
 	save_item(NAME(*m_bitmaps));
 }
 
+void epic12_device::device_stop()
+{
+	if (m_work_queue != nullptr)
+		osd_work_queue_wait(m_work_queue, osd_ticks_per_second() * 100);
+
+	if (m_split_queue != nullptr)
+	{
+		osd_work_queue_free(m_split_queue);
+		m_split_queue = nullptr;
+	}
+}
+
 void epic12_device::device_reset()
 {
 	if (m_is_unsafe)
@@ -109,7 +123,7 @@ void epic12_device::device_reset()
 UINT8 epic12_device_colrtable[0x20][0x40];
 UINT8 epic12_device_colrtable_rev[0x20][0x40];
 UINT8 epic12_device_colrtable_add[0x20][0x20];
-UINT64 epic12_device_blit_delay;
+std::atomic<UINT64> epic12_device_blit_delay;
 
 inline UINT16 epic12_device::READ_NEXT_WORD(offs_t *addr)
 {
@@ -200,7 +214,6 @@ inline void epic12_device::gfx_upload(offs_t *addr)
 	}
 }
 
-#define draw_params m_bitmaps.get(), &m_clip, &m_bitmaps->pix(0,0),src_x,src_y, x,y, dimx,dimy, flipy, s_alpha, d_alpha, &tint_clr
 
 
 
@@ -326,12 +339,71 @@ inline void epic12_device::gfx_draw_shadow_copy(address_space &space, offs_t *ad
 
 
 
+void *epic12_device::blit_chunk_callback(void *param, int threadid)
+{
+	blit_chunk *chunk = reinterpret_cast<blit_chunk *>(param);
+
+	chunk->func(chunk->bitmap, &chunk->clip, chunk->gfx, chunk->src_x, chunk->src_y, chunk->dst_x, chunk->dst_y, chunk->dimx, chunk->dimy, chunk->flipy, chunk->s_alpha, chunk->d_alpha, &chunk->tint_clr);
+	chunk->done = true;
+	return nullptr;
+}
+
+inline void epic12_device::draw_blit(epic12_device_blitfunction blitfunc, int src_x, int src_y, int x, int y, int dimx, int dimy, int flipy, UINT8 s_alpha, UINT8 d_alpha, const clr_t *tint_clr)
+{
+	UINT32 *gfx = &m_bitmaps->pix(0,0);
+	const int min_y = MAX(y, m_clip.min_y);
+	const int max_y = MIN(y + dimy - 1, m_clip.max_y);
+	const int rows = max_y - min_y + 1;
+
+	// big blits get split into bands of destination rows for the other cores, unless the source wraps or overlaps the destination
+	if (m_split_queue == nullptr || rows < BLIT_SPLIT_CHUNKS * 8 || dimx * rows < BLIT_SPLIT_MIN_PIXELS ||
+		src_y + dimy > 0x1000 ||
+		(src_x < x + dimx && x < src_x + dimx && src_y < y + dimy && y < src_y + dimy))
+	{
+		blitfunc(m_bitmaps.get(), &m_clip, gfx, src_x, src_y, x, y, dimx, dimy, flipy, s_alpha, d_alpha, tint_clr);
+		return;
+	}
+
+	for (int i = 0; i < BLIT_SPLIT_CHUNKS; i++)
+	{
+		blit_chunk &chunk = m_blit_chunks[i];
+
+		chunk.func = blitfunc;
+		chunk.bitmap = m_bitmaps.get();
+		chunk.clip = m_clip;
+		chunk.clip.min_y = min_y + (rows * i) / BLIT_SPLIT_CHUNKS;
+		chunk.clip.max_y = min_y + (rows * (i + 1)) / BLIT_SPLIT_CHUNKS - 1;
+		chunk.gfx = gfx;
+		chunk.src_x = src_x;
+		chunk.src_y = src_y;
+		chunk.dst_x = x;
+		chunk.dst_y = y;
+		chunk.dimx = dimx;
+		chunk.dimy = dimy;
+		chunk.flipy = flipy;
+		chunk.s_alpha = s_alpha;
+		chunk.d_alpha = d_alpha;
+		chunk.tint_clr = *tint_clr;
+		chunk.done = false;
+	}
+
+	// auto-released items can't report queueing failures, so draw whatever didn't get done here
+	osd_work_item_queue_multiple(m_split_queue, blit_chunk_callback, BLIT_SPLIT_CHUNKS, m_blit_chunks, sizeof(m_blit_chunks[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	osd_work_queue_wait(m_split_queue, WORK_QUEUE_WAIT_INFINITE);
+	for (int i = 0; i < BLIT_SPLIT_CHUNKS; i++)
+	{
+		if (!m_blit_chunks[i].done)
+			blit_chunk_callback(&m_blit_chunks[i], 0);
+	}
+}
+
 inline void epic12_device::gfx_draw(offs_t *addr)
 {
 	int x,y, dimx,dimy, flipx,flipy;//, src_p;
 	int trans,blend, s_mode, d_mode;
 	clr_t tint_clr;
 	int tinted = 0;
+	epic12_device_blitfunction blitfunc;
 
 	UINT16 attr     =   READ_NEXT_WORD(addr);
 	UINT16 alpha    =   READ_NEXT_WORD(addr);
@@ -405,22 +477,22 @@ inline void epic12_device::gfx_draw(offs_t *addr)
 			{
 				if (!blend)
 				{
-					draw_sprite_f0_ti1_tr1_plain(draw_params);
+					blitfunc = draw_sprite_f0_ti1_tr1_plain;
 				}
 				else
 				{
-					epic12_device_f0_ti1_tr1_blit_funcs[s_mode | (d_mode<<3)](draw_params);
+					blitfunc = epic12_device_f0_ti1_tr1_blit_funcs[s_mode | (d_mode<<3)];
 				}
 			}
 			else
 			{
 			if (!blend)
 				{
-					draw_sprite_f0_ti1_tr0_plain(draw_params);
+					blitfunc = draw_sprite_f0_ti1_tr0_plain;
 				}
 				else
 				{
-					epic12_device_f0_ti1_tr0_blit_funcs[s_mode | (d_mode<<3)](draw_params);
+					blitfunc = epic12_device_f0_ti1_tr0_blit_funcs[s_mode | (d_mode<<3)];
 				}
 			}
 		}
@@ -430,22 +502,22 @@ inline void epic12_device::gfx_draw(offs_t *addr)
 			{
 				if (!blend)
 				{
-					draw_sprite_f1_ti1_tr1_plain(draw_params);
+					blitfunc = draw_sprite_f1_ti1_tr1_plain;
 				}
 				else
 				{
-					epic12_device_f1_ti1_tr1_blit_funcs[s_mode | (d_mode<<3)](draw_params);
+					blitfunc = epic12_device_f1_ti1_tr1_blit_funcs[s_mode | (d_mode<<3)];
 				}
 			}
 			else
 			{
 			if (!blend)
 				{
-					draw_sprite_f1_ti1_tr0_plain(draw_params);
+					blitfunc = draw_sprite_f1_ti1_tr0_plain;
 				}
 				else
 				{
-					epic12_device_f1_ti1_tr0_blit_funcs[s_mode | (d_mode<<3)](draw_params);
+					blitfunc = epic12_device_f1_ti1_tr0_blit_funcs[s_mode | (d_mode<<3)];
 				}
 			}
 		}
@@ -458,22 +530,22 @@ inline void epic12_device::gfx_draw(offs_t *addr)
 			{
 				if (trans)
 				{
-					draw_sprite_f0_ti0_tr1_simple(draw_params);
+					blitfunc = draw_sprite_f0_ti0_tr1_simple;
 				}
 				else
 				{
-					draw_sprite_f0_ti0_tr0_simple(draw_params);
+					blitfunc = draw_sprite_f0_ti0_tr0_simple;
 				}
 			}
 			else
 			{
 				if (trans)
 				{
-					draw_sprite_f1_ti0_tr1_simple(draw_params);
+					blitfunc = draw_sprite_f1_ti0_tr1_simple;
 				}
 				else
 				{
-					draw_sprite_f1_ti0_tr0_simple(draw_params);
+					blitfunc = draw_sprite_f1_ti0_tr0_simple;
 				}
 
 			}
@@ -491,22 +563,22 @@ inline void epic12_device::gfx_draw(offs_t *addr)
 			{
 				if (!blend)
 				{
-					draw_sprite_f0_ti0_plain(draw_params);
+					blitfunc = draw_sprite_f0_ti0_plain;
 				}
 				else
 				{
-					epic12_device_f0_ti0_tr1_blit_funcs[s_mode | (d_mode<<3)](draw_params);
+					blitfunc = epic12_device_f0_ti0_tr1_blit_funcs[s_mode | (d_mode<<3)];
 				}
 			}
 			else
 			{
 			if (!blend)
 				{
-					draw_sprite_f0_ti0_tr0_plain(draw_params);
+					blitfunc = draw_sprite_f0_ti0_tr0_plain;
 				}
 				else
 				{
-					epic12_device_f0_ti0_tr0_blit_funcs[s_mode | (d_mode<<3)](draw_params);
+					blitfunc = epic12_device_f0_ti0_tr0_blit_funcs[s_mode | (d_mode<<3)];
 				}
 			}
 		}
@@ -516,32 +588,30 @@ inline void epic12_device::gfx_draw(offs_t *addr)
 			{
 				if (!blend)
 				{
-					draw_sprite_f1_ti0_plain(draw_params);
+					blitfunc = draw_sprite_f1_ti0_plain;
 				}
 				else
 				{
-					epic12_device_f1_ti0_tr1_blit_funcs[s_mode | (d_mode<<3)](draw_params);
+					blitfunc = epic12_device_f1_ti0_tr1_blit_funcs[s_mode | (d_mode<<3)];
 				}
 			}
 			else
 			{
 			if (!blend)
 				{
-					draw_sprite_f1_ti0_tr0_plain(draw_params);
+					blitfunc = draw_sprite_f1_ti0_tr0_plain;
 				}
 				else
 				{
-					epic12_device_f1_ti0_tr0_blit_funcs[s_mode | (d_mode<<3)](draw_params);
+					blitfunc = epic12_device_f1_ti0_tr0_blit_funcs[s_mode | (d_mode<<3)];
 				}
 			}
 		}
 	}
 
-
-
+	draw_blit(blitfunc, src_x, src_y, x, y, dimx, dimy, flipy, s_alpha, d_alpha, &tint_clr);
 }
 
-
 void epic12_device::gfx_create_shadow_copy(address_space &space)
 {
 	offs_t addr = m_gfx_addr & 0x1fffffff;
@@ -2,6 +2,9 @@
 // copyright-holders:David Haywood, Luca Elia, MetalliC
 /* emulation of Altera Cyclone EPIC12 FPGA programmed as a blitter */
 
+#include <atomic>
+#include "video/rgbutil.h"
+
 #define MCFG_EPIC12_ADD(_tag) \
 	MCFG_DEVICE_ADD(_tag, EPIC12, 0)
 
@@ -12,7 +15,7 @@
 extern UINT8 epic12_device_colrtable[0x20][0x40];
 extern UINT8 epic12_device_colrtable_rev[0x20][0x40];
 extern UINT8 epic12_device_colrtable_add[0x20][0x20];
-extern UINT64 epic12_device_blit_delay;
+extern std::atomic<UINT64> epic12_device_blit_delay;
 
 struct _clr_t
 {
@@ -102,6 +105,8 @@ public:
 	inline void gfx_draw_shadow_copy(address_space &space, offs_t *addr);
 	inline void gfx_upload(offs_t *addr);
 	inline void gfx_draw(offs_t *addr);
+	inline void draw_blit(epic12_device_blitfunction blitfunc, int src_x, int src_y, int x, int y, int dimx, int dimy, int flipy, UINT8 s_alpha, UINT8 d_alpha, const clr_t *tint_clr);
+	static void *blit_chunk_callback(void *param, int threadid);
 	void gfx_exec(void);
 	DECLARE_READ32_MEMBER( gfx_ready_r );
 	DECLARE_WRITE32_MEMBER( gfx_exec_w );
@@ -801,6 +806,16 @@ public:
 		clr->b = epic12_device_colrtable_rev[val][(clr0->b)];
 	}
 
+	// rgbaint_t version of the colrtable lookup, for products of up to 0x1f * 0x3f
+	// (x * 0x421 + 0x421) >> 15 is exactly x / 0x1f in that range
+	static inline void clr_div_1f(rgbaint_t &clr)
+	{
+		clr.add_imm(1);
+		clr.mul_imm(0x421);
+		clr.shr_imm(15);
+		clr.min(0x1f);
+	}
+
 	static inline void clr_copy(clr_t *clr, const clr_t *clr0)
 	{
 		clr->r = clr0->r;
@@ -823,11 +838,34 @@ public:
 
 protected:
 	virtual void device_start() override;
+	virtual void device_stop() override;
 	virtual void device_reset() override;
 
 	osd_work_queue *m_work_queue;
 	osd_work_item *m_blitter_request;
 
+	// large blits are split across this queue by destination rows
+	static const int BLIT_SPLIT_CHUNKS = 4;
+	static const int BLIT_SPLIT_MIN_PIXELS = 0x4000;
+
+	struct blit_chunk
+	{
+		epic12_device_blitfunction func;
+		bitmap_rgb32 *bitmap;
+		rectangle clip;
+		UINT32 *gfx;
+		int src_x, src_y;
+		int dst_x, dst_y;
+		int dimx, dimy;
+		int flipy;
+		UINT8 s_alpha, d_alpha;
+		clr_t tint_clr;
+		bool done;
+	};
+
+	osd_work_queue *m_split_queue;
+	blit_chunk m_blit_chunks[BLIT_SPLIT_CHUNKS];
+
 	// blit timing
 	emu_timer *m_blitter_delay_timer;
 	int m_blitter_busy;
@@ -2,16 +2,29 @@
 // copyright-holders:David Haywood
 /* blitter function */
 
+/* tinted and the most common blend modes work on all three components at once in an rgbaint_t */
+#if BLENDED == 0
+#define EPIC12_SIMD TINT
+#elif (_SMODE == 0 && (_DMODE == 0 || _DMODE == 3 || _DMODE == 4)) || (_SMODE == 2 && _DMODE == 0)
+#define EPIC12_SIMD 1
+#else
+#define EPIC12_SIMD 0
+#endif
+
 void epic12_device::FUNCNAME(BLIT_PARAMS)
 {
 	UINT32* gfx2;
 	int y, yf;
 
-#if REALLY_SIMPLE == 0
+#if REALLY_SIMPLE == 0 && EPIC12_SIMD == 0
 	colour_t s_clr;
 #endif
 
-#if BLENDED == 1
+#if EPIC12_SIMD == 1 && TINT == 1
+	const rgbaint_t tint_rgb(0, tint_clr->r, tint_clr->g, tint_clr->b);
+#endif
+
+#if BLENDED == 1 && EPIC12_SIMD == 0
 	colour_t d_clr;
 
 #if _SMODE == 2
@@ -91,7 +104,7 @@ void epic12_device::FUNCNAME(BLIT_PARAMS)
 		//printf("delay is now %d\n", epic12_device_blit_delay);
 	}
 
-#if BLENDED == 1
+#if BLENDED == 1 && EPIC12_SIMD == 0
 #if _SMODE == 0
 #if _DMODE == 0
 	const UINT8* salpha_table = epic12_device_colrtable[s_alpha];
@@ -166,3 +179,4 @@ void epic12_device::FUNCNAME(BLIT_PARAMS)
 }
 
 #undef LOOP_INCREMENTS
+#undef EPIC12_SIMD
@@ -36,6 +36,43 @@
 			{
 #endif
 
+#if EPIC12_SIMD == 1
+			rgbaint_t s_rgb((pen >> 3) & 0x001f1f1f);
+
+#if TINT == 1
+			s_rgb.mul(tint_rgb);
+			clr_div_1f(s_rgb);
+#endif
+
+			#if BLENDED == 1
+				rgbaint_t d_rgb((*bmp >> 3) & 0x001f1f1f);
+
+				#if _SMODE == 0
+					s_rgb.mul_imm(s_alpha);
+					clr_div_1f(s_rgb);
+
+					#if _DMODE == 0
+					d_rgb.mul_imm(d_alpha);
+					clr_div_1f(d_rgb);
+					#elif _DMODE == 4
+					d_rgb.mul_imm(d_alpha ^ 0x1f);
+					clr_div_1f(d_rgb);
+					#endif
+				#elif _SMODE == 2
+					// _DMODE == 0
+					s_rgb.mul(d_rgb);
+					clr_div_1f(s_rgb);
+					d_rgb.mul_imm(d_alpha);
+					clr_div_1f(d_rgb);
+				#endif
+
+				s_rgb.add(d_rgb);
+				s_rgb.min(0x1f);
+			#endif
+
+			// write result
+			*bmp = (s_rgb.to_rgba() << 3) | (pen & 0x20000000);
+#else
 			// convert source to clr
 			pen_to_clr(pen, &s_clr.trgb);
 			//s_clr.u32 = (pen >> 3); // using the union is actually significantly slower than our pen_to_clr to function!
@@ -186,6 +223,7 @@
 			// write result
 			*bmp = clr_to_pen(&s_clr.trgb)|(pen&0x20000000);
 			//*bmp = (s_clr.u32<<3)|(pen&0x20000000); // using the union is actually significantly slower than our clr_to_pen function!
+#endif // EPIC12_SIMD
 
 #endif // END NOT REALLY SIMPLE
 
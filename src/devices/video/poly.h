@@ -63,10 +63,12 @@
 #define POLYFLAG_INCLUDE_RIGHT_EDGE         0x02
 #define POLYFLAG_NO_WORK_QUEUE              0x04
 
-#define SCANLINES_PER_BUCKET                8
+#define SCANLINES_PER_BUCKET                8           // maximum, reduced for short screens or many threads
+#define MIN_SCANLINES_PER_BUCKET            4           // keeps small polygons from being split into many units
+#define BUCKETS_PER_THREAD                  4           // target number of buckets per worker thread
 #define CACHE_LINE_SIZE                     64          // this is a general guess
-#define TOTAL_BUCKETS                       (512 / SCANLINES_PER_BUCKET)
-#define UNITS_PER_POLY                      (100 / SCANLINES_PER_BUCKET)
+#define DEFAULT_BUCKET_SCANLINES            512         // lines covered by buckets without a screen
+#define SCANLINES_PER_POLY                  100         // average polygon height for sizing the unit array
 
 
 
@@ -177,7 +179,7 @@ private:
 	};
 
 	// class for managing an array of items
-	template<class _Type, int _Count>
+	template<class _Type>
 	class poly_array
 	{
 		// size of an item, rounded up to the cache line size
@@ -185,9 +187,10 @@ private:
 
 	public:
 		// construction
-		poly_array(running_machine &machine, poly_manager &manager)
+		poly_array(running_machine &machine, poly_manager &manager, int count)
 			: m_manager(manager),
-				m_base(make_unique_clear<UINT8[]>(k_itemsize * _Count)),
+				m_base(make_unique_clear<UINT8[]>(k_itemsize * count)),
+				m_count(count),
 				m_next(0),
 				m_max(0),
 				m_waits(0) { }
@@ -196,35 +199,36 @@ private:
 		~poly_array() { m_base = nullptr; }
 
 		// operators
-		_Type &operator[](int index) const { assert(index >= 0 && index < _Count); return *reinterpret_cast<_Type *>(m_base.get() + index * k_itemsize); }
+		_Type &operator[](int index) const { assert(index >= 0 && index < m_count); return *reinterpret_cast<_Type *>(m_base.get() + index * k_itemsize); }
 
 		// getters
 		int count() const { return m_next; }
 		int max() const { return m_max; }
 		int waits() const { return m_waits; }
 		int itemsize() const { return k_itemsize; }
-		int allocated() const { return _Count; }
-		int indexof(_Type &item) const { int result = (reinterpret_cast<UINT8 *>(&item) - m_base.get()) / k_itemsize; assert(result >= 0 && result < _Count); return result; }
+		int allocated() const { return m_count; }
+		int indexof(_Type &item) const { int result = (reinterpret_cast<UINT8 *>(&item) - m_base.get()) / k_itemsize; assert(result >= 0 && result < m_count); return result; }
 
 		// operations
 		void reset() { m_next = 0; }
-		_Type &next() { if (m_next > m_max) m_max = m_next; assert(m_next < _Count); return *new(m_base.get() + m_next++ * k_itemsize) _Type; }
+		_Type &next() { if (m_next > m_max) m_max = m_next; assert(m_next < m_count); return *new(m_base.get() + m_next++ * k_itemsize) _Type; }
 		_Type &last() const { return (*this)[m_next - 1]; }
-		void wait_for_space(int count = 1) { while ((m_next + count) >= _Count) { m_waits++; m_manager.wait(""); }  }
+		void wait_for_space(int count = 1) { while ((m_next + count) >= m_count) { m_waits++; m_manager.wait(""); }  }
 
 	private:
 		// internal state
 		poly_manager &      m_manager;
 		std::unique_ptr<UINT8[]>             m_base;
+		int                 m_count;
 		int                 m_next;
 		int                 m_max;
 		int                 m_waits;
 	};
 
 	// internal array types
-	typedef poly_array<polygon_info, _MaxPolys> polygon_array;
-	typedef poly_array<_ObjectData, _MaxPolys + 1> objectdata_array;
-	typedef poly_array<work_unit, MIN(_MaxPolys * UNITS_PER_POLY, 65535)> unit_array;
+	typedef poly_array<polygon_info> polygon_array;
+	typedef poly_array<_ObjectData> objectdata_array;
+	typedef poly_array<work_unit> unit_array;
 
 	// round in a cross-platform consistent manner
 	inline INT32 round_coordinate(_BaseType value)
@@ -241,7 +245,7 @@ private:
 	{
 		// wait for space in the polygon and unit arrays
 		m_polygon.wait_for_space();
-		m_unit.wait_for_space((maxy - miny) / SCANLINES_PER_BUCKET + 2);
+		m_unit.wait_for_space(((maxy - miny) >> m_bucket_shift) + 2);
 
 		// return and initialize the next one
 		polygon_info &polygon = m_polygon.next();
@@ -251,14 +255,40 @@ private:
 		return polygon;
 	}
 
+	// choose the bucket size so that a screen of the given height spreads over enough buckets for all
+	// threads servicing the queue, plus the calling thread
+	static int bucket_shift_for(int height, osd_work_queue *queue)
+	{
+		int lines = SCANLINES_PER_BUCKET;
+		if (queue != nullptr)
+		{
+			int buckets = (osd_work_queue_threads(queue) + 1) * BUCKETS_PER_THREAD;
+			while (lines > MIN_SCANLINES_PER_BUCKET && height / lines < buckets)
+				lines /= 2;
+		}
+		int shift = 0;
+		while ((1 << shift) < lines)
+			shift++;
+		return shift;
+	}
+	static int unit_count_for(int bucket_shift) { return MIN(_MaxPolys * (SCANLINES_PER_POLY >> bucket_shift), 65535); }
+
 	static void *work_item_callback(void *param, int threadid);
 	void presave() { wait("pre-save"); }
+#if KEEP_POLY_STATISTICS
+	void vblank(screen_device &screen, bool vblank_state);
+#endif
 
 	// queue management
 	running_machine &   m_machine;
 	screen_device *     m_screen;
 	osd_work_queue *    m_queue;                    // work queue
 
+	// bucket geometry
+	int                 m_bucket_shift;             // log2 of scanlines per bucket
+	int                 m_bucket_lines;             // scanlines per bucket
+	int                 m_bucket_count;             // number of buckets
+
 	// arrays
 	polygon_array       m_polygon;                  // array of polygons
 	objectdata_array    m_object;                   // array of object data
@@ -268,7 +298,7 @@ private:
 	UINT8               m_flags;                    // flags
 
 	// buckets
-	UINT16              m_unit_bucket[TOTAL_BUCKETS]; // buckets for tracking unit usage
+	std::vector<UINT16> m_unit_bucket;              // buckets for tracking unit usage
 
 	// statistics
 	UINT32              m_tiles;                    // number of tiles queued
@@ -278,6 +308,15 @@ private:
 #if KEEP_POLY_STATISTICS
 	UINT32              m_conflicts[WORK_MAX_THREADS]; // number of conflicts found, per thread
 	UINT32              m_resolved[WORK_MAX_THREADS];   // number of conflicts resolved, per thread
+
+	// per-frame statistics, reported at VBLANK
+	UINT32              m_frame_units;              // work units queued
+	UINT32              m_frame_waits;              // calls to wait()
+	osd_ticks_t         m_frame_wait_ticks;         // time spent in wait()
+	osd_ticks_t         m_frame_start;              // time the frame started
+	UINT32              m_frame_scanlines[WORK_MAX_THREADS]; // scanlines rendered, per thread
+	osd_ticks_t         m_frame_busy[WORK_MAX_THREADS]; // time spent rendering, per thread
+	UINT32              m_frame_deferred[WORK_MAX_THREADS]; // units chained behind a busy bucket, per thread
 #endif
 };
 
@@ -290,11 +329,15 @@ template<typename _BaseType, class _ObjectData, int _MaxParams, int _MaxPolys>
 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::poly_manager(running_machine &machine, UINT8 flags)
 	: m_machine(machine),
 		m_screen(nullptr),
-		m_queue(nullptr),
-		m_polygon(machine, *this),
-		m_object(machine, *this),
-		m_unit(machine, *this),
+		m_queue((flags & POLYFLAG_NO_WORK_QUEUE) ? nullptr : osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ)),
+		m_bucket_shift(bucket_shift_for(DEFAULT_BUCKET_SCANLINES, m_queue)),
+		m_bucket_lines(1 << m_bucket_shift),
+		m_bucket_count((MAX(DEFAULT_BUCKET_SCANLINES, 1) + m_bucket_lines - 1) >> m_bucket_shift),
+		m_polygon(machine, *this, _MaxPolys),
+		m_object(machine, *this, _MaxPolys + 1),
+		m_unit(machine, *this, unit_count_for(m_bucket_shift)),
 		m_flags(flags),
+		m_unit_bucket(m_bucket_count, 0xffff),
 		m_triangles(0),
 		m_quads(0),
 		m_pixels(0)
@@ -302,12 +345,14 @@ poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::poly_manager(runnin
 #if KEEP_POLY_STATISTICS
 	memset(m_conflicts, 0, sizeof(m_conflicts));
 	memset(m_resolved, 0, sizeof(m_resolved));
+	m_frame_units = m_frame_waits = 0;
+	m_frame_wait_ticks = 0;
+	m_frame_start = get_profile_ticks();
+	memset(m_frame_scanlines, 0, sizeof(m_frame_scanlines));
+	memset(m_frame_busy, 0, sizeof(m_frame_busy));
+	memset(m_frame_deferred, 0, sizeof(m_frame_deferred));
 #endif
 
-	// create the work queue
-	if (!(flags & POLYFLAG_NO_WORK_QUEUE))
-		m_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
-
 	// request a pre-save callback for synchronization
 	machine.save().register_presave(save_prepost_delegate(FUNC(poly_manager::presave), this));
 }
@@ -317,11 +362,15 @@ template<typename _BaseType, class _ObjectData, int _MaxParams, int _MaxPolys>
 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::poly_manager(screen_device &screen, UINT8 flags)
 	: m_machine(screen.machine()),
 		m_screen(&screen),
-		m_queue(nullptr),
-		m_polygon(screen.machine(), *this),
-		m_object(screen.machine(), *this),
-		m_unit(screen.machine(), *this),
+		m_queue((flags & POLYFLAG_NO_WORK_QUEUE) ? nullptr : osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ)),
+		m_bucket_shift(bucket_shift_for(screen.height(), m_queue)),
+		m_bucket_lines(1 << m_bucket_shift),
+		m_bucket_count((MAX(screen.height(), 1) + m_bucket_lines - 1) >> m_bucket_shift),
+		m_polygon(screen.machine(), *this, _MaxPolys),
+		m_object(screen.machine(), *this, _MaxPolys + 1),
+		m_unit(screen.machine(), *this, unit_count_for(m_bucket_shift)),
 		m_flags(flags),
+		m_unit_bucket(m_bucket_count, 0xffff),
 		m_triangles(0),
 		m_quads(0),
 		m_pixels(0)
@@ -329,12 +378,17 @@ poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::poly_manager(screen
 #if KEEP_POLY_STATISTICS
 	memset(m_conflicts, 0, sizeof(m_conflicts));
 	memset(m_resolved, 0, sizeof(m_resolved));
+	m_frame_units = m_frame_waits = 0;
+	m_frame_wait_ticks = 0;
+	m_frame_start = get_profile_ticks();
+	memset(m_frame_scanlines, 0, sizeof(m_frame_scanlines));
+	memset(m_frame_busy, 0, sizeof(m_frame_busy));
+	memset(m_frame_deferred, 0, sizeof(m_frame_deferred));
+
+	// report per-frame statistics at VBLANK
+	screen.register_vblank_callback(vblank_state_delegate(FUNC(poly_manager::vblank), this));
 #endif
 
-	// create the work queue
-	if (!(flags & POLYFLAG_NO_WORK_QUEUE))
-		m_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
-
 	// request a pre-save callback for synchronization
 	machine().save().register_presave(save_prepost_delegate(FUNC(poly_manager::presave), this));
 }
@@ -412,7 +466,10 @@ void *poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::work_item_cal
 				// track resolved conflicts
 				polygon.m_owner->m_conflicts[threadid]++;
 				if (orig_count_next != 0)
+				{
 					polygon.m_owner->m_resolved[threadid]++;
+					polygon.m_owner->m_frame_deferred[threadid]++;
+				}
 #endif
 				// if we succeeded, skip out early so we can do other work
 				if (orig_count_next != 0)
@@ -421,8 +478,15 @@ void *poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::work_item_cal
 		}
 
 		// iterate over extents
+#if KEEP_POLY_STATISTICS
+		osd_ticks_t start = get_profile_ticks();
+#endif
 		for (int curscan = 0; curscan < count; curscan++)
 			polygon.m_callback(unit.scanline + curscan, unit.extent[curscan], *polygon.m_object, threadid);
+#if KEEP_POLY_STATISTICS
+		polygon.m_owner->m_frame_busy[threadid] += get_profile_ticks() - start;
+		polygon.m_owner->m_frame_scanlines[threadid] += count;
+#endif
 
 		// set our count to 0 and re-fetch the original count value
 		do
@@ -450,7 +514,7 @@ void poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::wait(const cha
 	osd_ticks_t time;
 
 	// remember the start time if we're logging
-	if (LOG_WAITS)
+	if (LOG_WAITS || KEEP_POLY_STATISTICS)
 		time = get_profile_ticks();
 
 	// wait for all pending work items to complete
@@ -463,17 +527,22 @@ void poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::wait(const cha
 			work_item_callback(&m_unit[unitnum], 0);
 
 	// log any long waits
-	if (LOG_WAITS)
+	if (LOG_WAITS || KEEP_POLY_STATISTICS)
 	{
 		time = get_profile_ticks() - time;
-		if (time > LOG_WAIT_THRESHOLD)
+		if (LOG_WAITS && time > LOG_WAIT_THRESHOLD)
 			machine().logerror("Poly:Waited %d cycles for %s\n", (int)time, debug_reason);
+#if KEEP_POLY_STATISTICS
+		m_frame_waits++;
+		m_frame_wait_ticks += time;
+		m_frame_units += m_unit.count();
+#endif
 	}
 
 	// reset the state
 	m_polygon.reset();
 	m_unit.reset();
-	memset(m_unit_bucket, 0xff, sizeof(m_unit_bucket));
+	std::fill(m_unit_bucket.begin(), m_unit_bucket.end(), 0xffff);
 
 	// we need to preserve the last object data that was supplied
 	if (m_object.count() > 0)
@@ -487,6 +556,38 @@ void poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::wait(const cha
 }
 
 
+#if KEEP_POLY_STATISTICS
+
+//-------------------------------------------------
+//  vblank - report and reset per-frame statistics
+//-------------------------------------------------
+
+template<typename _BaseType, class _ObjectData, int _MaxParams, int _MaxPolys>
+void poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::vblank(screen_device &screen, bool vblank_state)
+{
+	if (!vblank_state)
+		return;
+
+	osd_ticks_t now = get_profile_ticks();
+	osd_ticks_t frame = now - m_frame_start;
+	machine().logerror("Poly:frame %d: %d lines/bucket, %d units, %d waits (%d%% of frame)\n",
+		(int)screen.frame_number(), m_bucket_lines, m_frame_units, m_frame_waits, (frame != 0) ? (int)(m_frame_wait_ticks * 100 / frame) : 0);
+	for (int i = 0; i < WORK_MAX_THREADS; i++)
+		if (m_frame_scanlines[i] != 0)
+			machine().logerror("Poly:  thread %2d: %6d scanlines, %5d deferred, %3d%% busy\n",
+				i, m_frame_scanlines[i], m_frame_deferred[i], (frame != 0) ? (int)(m_frame_busy[i] * 100 / frame) : 0);
+
+	m_frame_units = m_frame_waits = 0;
+	m_frame_wait_ticks = 0;
+	m_frame_start = now;
+	memset(m_frame_scanlines, 0, sizeof(m_frame_scanlines));
+	memset(m_frame_busy, 0, sizeof(m_frame_busy));
+	memset(m_frame_deferred, 0, sizeof(m_frame_deferred));
+}
+
+#endif
+
+
 //-------------------------------------------------
 //  object_data_alloc - allocate a new _ObjectData
 //-------------------------------------------------
@@ -583,12 +684,12 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_tile(
 	INT32 scaninc = 1;
 	for (INT32 curscan = v1yclip; curscan < v2yclip; curscan += scaninc)
 	{
-		UINT32 bucketnum = ((UINT32)curscan / SCANLINES_PER_BUCKET) % TOTAL_BUCKETS;
+		UINT32 bucketnum = ((UINT32)curscan >> m_bucket_shift) % m_bucket_count;
 		UINT32 unit_index = m_unit.count();
 		work_unit &unit = m_unit.next();
 
 		// determine how much to advance to hit the next bucket
-		scaninc = SCANLINES_PER_BUCKET - (UINT32)curscan % SCANLINES_PER_BUCKET;
+		scaninc = m_bucket_lines - ((UINT32)curscan & (m_bucket_lines - 1));
 
 		// fill in the work unit basics
 		unit.polygon = &polygon;
@@ -741,12 +842,12 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_trian
 	INT32 scaninc = 1;
 	for (INT32 curscan = v1yclip; curscan < v3yclip; curscan += scaninc)
 	{
-		UINT32 bucketnum = ((UINT32)curscan / SCANLINES_PER_BUCKET) % TOTAL_BUCKETS;
+		UINT32 bucketnum = ((UINT32)curscan >> m_bucket_shift) % m_bucket_count;
 		UINT32 unit_index = m_unit.count();
 		work_unit &unit = m_unit.next();
 
 		// determine how much to advance to hit the next bucket
-		scaninc = SCANLINES_PER_BUCKET - (UINT32)curscan % SCANLINES_PER_BUCKET;
+		scaninc = m_bucket_lines - ((UINT32)curscan & (m_bucket_lines - 1));
 
 		// fill in the work unit basics
 		unit.polygon = &polygon;
@@ -874,12 +975,12 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_trian
 	INT32 scaninc = 1;
 	for (INT32 curscan = v1yclip; curscan < v3yclip; curscan += scaninc)
 	{
-		UINT32 bucketnum = ((UINT32)curscan / SCANLINES_PER_BUCKET) % TOTAL_BUCKETS;
+		UINT32 bucketnum = ((UINT32)curscan >> m_bucket_shift) % m_bucket_count;
 		UINT32 unit_index = m_unit.count();
 		work_unit &unit = m_unit.next();
 
 		// determine how much to advance to hit the next bucket
-		scaninc = SCANLINES_PER_BUCKET - (UINT32)curscan % SCANLINES_PER_BUCKET;
+		scaninc = m_bucket_lines - ((UINT32)curscan & (m_bucket_lines - 1));
 
 		// fill in the work unit basics
 		unit.polygon = &polygon;
@@ -1049,12 +1150,12 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_polyg
 	INT32 scaninc = 1;
 	for (INT32 curscan = minyclip; curscan < maxyclip; curscan += scaninc)
 	{
-		UINT32 bucketnum = ((UINT32)curscan / SCANLINES_PER_BUCKET) % TOTAL_BUCKETS;
+		UINT32 bucketnum = ((UINT32)curscan >> m_bucket_shift) % m_bucket_count;
 		UINT32 unit_index = m_unit.count();
 		work_unit &unit = m_unit.next();
 
 		// determine how much to advance to hit the next bucket
-		scaninc = SCANLINES_PER_BUCKET - (UINT32)curscan % SCANLINES_PER_BUCKET;
+		scaninc = m_bucket_lines - ((UINT32)curscan & (m_bucket_lines - 1));
 
 		// fill in the work unit basics
 		unit.polygon = &polygon;
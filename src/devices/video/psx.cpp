@@ -14,6 +14,16 @@
 
 #define VERBOSE_LEVEL ( 0 )
 
+// GP0 words are queued and executed on a worker thread, the cpu only waits when it needs a result
+#define THREADED_FIFO ( !DEBUG_VIEWER )
+#define FIFO_BATCH_WORDS ( 1024 )
+
+struct psx_gpu_fifo_batch
+{
+	psxgpu_device *gpu;
+	std::vector<UINT32> words;
+};
+
 // device type definition
 const device_type CXD8514Q = &device_creator<cxd8514q_device>;
 const device_type CXD8538Q = &device_creator<cxd8538q_device>;
@@ -24,7 +34,11 @@ const device_type CXD8654Q = &device_creator<cxd8654q_device>;
 
 psxgpu_device::psxgpu_device(const machine_config &mconfig, device_type type, const char *name, const char *tag, device_t *owner, UINT32 clock, const char *shortname, const char *source) :
 	device_t(mconfig, type, name, tag, owner, clock, shortname, source),
-	m_vblank_handler(*this)
+	m_vblank_handler(*this),
+	m_fifo_queue(nullptr),
+	m_status_shadow(0),
+	m_status_offset(0),
+	m_status_pixels(0)
 #if DEBUG_VIEWER
 ,
 	m_screen(*this, "screen")
@@ -44,11 +58,32 @@ void psxgpu_device::device_start( void )
 	{
 		psx_gpu_init( 2 );
 	}
+
+	m_main_thread = std::this_thread::get_id();
+#if THREADED_FIFO
+	m_fifo_queue = osd_work_queue_alloc( WORK_QUEUE_FLAG_HIGH_FREQ );
+	m_fifo.reserve( FIFO_BATCH_WORDS );
+#endif
+	machine().save().register_presave( save_prepost_delegate( FUNC( psxgpu_device::fifo_sync ), this ) );
+	machine().save().register_postload( save_prepost_delegate( FUNC( psxgpu_device::status_sync ), this ) );
+	status_sync();
 }
 
 void psxgpu_device::device_reset( void )
 {
+	fifo_sync();
 	gpu_reset();
+	status_sync();
+}
+
+void psxgpu_device::device_stop( void )
+{
+	if( m_fifo_queue != nullptr )
+	{
+		fifo_sync();
+		osd_work_queue_free( m_fifo_queue );
+		m_fifo_queue = nullptr;
+	}
 }
 
 cxd8514q_device::cxd8514q_device(const machine_config &mconfig, const char *tag, device_t *owner, UINT32 clock)
@@ -101,7 +136,7 @@ static const UINT16 m_p_n_prevpointlist3[] = { 2, 0, 1 };
 #define TEXTURE_V( a ) ( a.b.h )
 #define TEXTURE_U( a ) ( a.b.l )
 
-static inline void ATTR_PRINTF(3,4) verboselog( device_t& device, int n_level, const char *s_fmt, ... )
+void psxgpu_device::verboselog( psxgpu_device &device, int n_level, const char *s_fmt, ... )
 {
 	if( VERBOSE_LEVEL >= n_level )
 	{
@@ -110,7 +145,16 @@ static inline void ATTR_PRINTF(3,4) verboselog( device_t& device, int n_level, c
 		va_start( v, s_fmt );
 		vsprintf( buf, s_fmt, v );
 		va_end( v );
-		device.logerror( "%s: %s", device.machine().describe_context(), buf );
+
+		// messages from the fifo worker are logged by fifo_sync() on the emulation thread
+		if( std::this_thread::get_id() != device.m_main_thread )
+		{
+			device.m_fifo_log.append( buf );
+		}
+		else
+		{
+			device.logerror( "%s: %s", device.machine().describe_context(), buf );
+		}
 	}
 }
 
@@ -607,6 +651,8 @@ void psxgpu_device::psx_gpu_init( int n_gputype )
 
 UINT32 psxgpu_device::update_screen(screen_device &screen, bitmap_ind16 &bitmap, const rectangle &cliprect)
 {
+	fifo_sync();
+
 	UINT32 n_x;
 	UINT32 n_y;
 	int n_top;
@@ -775,12 +821,22 @@ f  e| d  c| b| a  9| 8  7| 6  5| 4| 3  2  1  0
     |iy|ix|ty|     |   tp|  abr|ty|         tx
 */
 
-void psxgpu_device::decode_tpage( UINT32 tpage )
+UINT32 psxgpu_device::tpage_status( UINT32 status, UINT32 tpage ) const
 {
 	if( m_n_gputype == 2 )
 	{
-		n_gpustatus = ( n_gpustatus & 0xfffff800 ) | ( tpage & 0x7ff );
+		return ( status & 0xfffff800 ) | ( tpage & 0x7ff );
+	}
+
+	return ( status & 0xffffe000 ) | ( tpage & 0x1fff );
+}
 
+void psxgpu_device::decode_tpage( UINT32 tpage )
+{
+	n_gpustatus = tpage_status( n_gpustatus, tpage );
+
+	if( m_n_gputype == 2 )
+	{
 		m_n_tx = ( tpage & 0x0f ) << 6;
 		m_n_ty = ( ( tpage & 0x10 ) << 4 ) | ( ( tpage & 0x800 ) >> 2 );
 		n_abr = ( tpage & 0x60 ) >> 5;
@@ -799,8 +855,6 @@ void psxgpu_device::decode_tpage( UINT32 tpage )
 	}
 	else
 	{
-		n_gpustatus = ( n_gpustatus & 0xffffe000 ) | ( tpage & 0x1fff );
-
 		m_n_tx = ( tpage & 0x0f ) << 6;
 		m_n_ty = ( ( tpage & 0x60 ) << 3 );
 		n_abr = ( tpage & 0x180 ) >> 7;
@@ -3038,9 +3092,282 @@ void psxgpu_device::MoveImage( void )
 void psxgpu_device::dma_write( UINT32 *p_n_psxram, UINT32 n_address, INT32 n_size )
 {
 	gpu_write( &p_n_psxram[ n_address / 4 ], n_size );
+	fifo_flush();
 }
 
 void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
+{
+	if( m_fifo_queue == nullptr )
+	{
+		gpu_execute( p_ram, n_size );
+		return;
+	}
+
+	for( INT32 n_word = 0; n_word < n_size; n_word++ )
+	{
+		status_track( p_ram[ n_word ] );
+	}
+
+	m_fifo.insert( m_fifo.end(), p_ram, p_ram + n_size );
+	if( m_fifo.size() >= FIFO_BATCH_WORDS )
+	{
+		fifo_flush();
+	}
+}
+
+void *psxgpu_device::fifo_callback( void *param, int threadid )
+{
+	psx_gpu_fifo_batch *batch = (psx_gpu_fifo_batch *)param;
+
+	batch->gpu->gpu_execute( &batch->words[ 0 ], batch->words.size() );
+	global_free( batch );
+	return nullptr;
+}
+
+void psxgpu_device::fifo_flush( void )
+{
+	if( m_fifo.empty() )
+	{
+		return;
+	}
+
+	psx_gpu_fifo_batch *batch = global_alloc( psx_gpu_fifo_batch );
+	batch->gpu = this;
+	batch->words.swap( m_fifo );
+	m_fifo.reserve( FIFO_BATCH_WORDS );
+
+	// the queue has a single thread, so batches execute in the order they were written
+	if( osd_work_item_queue( m_fifo_queue, fifo_callback, batch, WORK_ITEM_FLAG_AUTO_RELEASE ) == nullptr )
+	{
+		fifo_callback( batch, 0 );
+	}
+}
+
+void psxgpu_device::fifo_sync( void )
+{
+	if( m_fifo_queue != nullptr )
+	{
+		fifo_flush();
+		osd_work_queue_wait( m_fifo_queue, WORK_QUEUE_WAIT_INFINITE );
+		status_sync();
+
+		if( !m_fifo_log.empty() )
+		{
+			logerror( "%s", m_fifo_log.c_str() );
+			m_fifo_log.clear();
+		}
+	}
+}
+
+void psxgpu_device::status_sync( void )
+{
+	m_status_shadow = n_gpustatus;
+	m_status_offset = n_gpu_buffer_offset;
+	memcpy( m_status_entry, m_packet.n_entry, sizeof( m_status_entry ) );
+
+	if( ( m_status_entry[ 0 ] >> 24 ) == 0xa0 && m_status_offset == gp0_packet_words( 0xa0 ) - 1 )
+	{
+		UINT32 n_width = std::max<UINT32>( m_status_entry[ 2 ] & 0xffff, 1 );
+		UINT32 n_height = std::max<UINT32>( m_status_entry[ 2 ] >> 16, 1 );
+
+		m_status_pixels = ( n_width * n_height ) - ( ( n_vramy * n_width ) + n_vramx );
+	}
+}
+
+/*
+number of words in a GP0 packet; for polylines this is a single segment and for
+image transfers the header in front of the pixel data
+*/
+
+UINT32 psxgpu_device::gp0_packet_words( UINT32 n_command )
+{
+	switch( n_command )
+	{
+	case 0x68:
+	case 0x6a:
+	case 0x70:
+	case 0x71:
+	case 0x78:
+	case 0x79:
+		return 2;
+	case 0x02:
+	case 0x40:
+	case 0x41:
+	case 0x42:
+	case 0x60:
+	case 0x61:
+	case 0x62:
+	case 0x63:
+	case 0x74:
+	case 0x75:
+	case 0x76:
+	case 0x77:
+	case 0x7c:
+	case 0x7d:
+	case 0x7e:
+	case 0x7f:
+	case 0xc0:
+		return 3;
+	case 0x20:
+	case 0x21:
+	case 0x22:
+	case 0x23:
+	case 0x48:
+	case 0x4a:
+	case 0x4c:
+	case 0x4e:
+	case 0x50:
+	case 0x51:
+	case 0x52:
+	case 0x53:
+	case 0x64:
+	case 0x65:
+	case 0x66:
+	case 0x67:
+	case 0x80:
+	case 0xa0:
+		return 4;
+	case 0x28:
+	case 0x29:
+	case 0x2a:
+	case 0x2b:
+		return 5;
+	case 0x30:
+	case 0x31:
+	case 0x32:
+	case 0x33:
+	case 0x58:
+	case 0x5a:
+	case 0x5c:
+	case 0x5e:
+		return 6;
+	case 0x24:
+	case 0x25:
+	case 0x26:
+	case 0x27:
+		return 7;
+	case 0x38:
+	case 0x39:
+	case 0x3a:
+	case 0x3b:
+		return 8;
+	case 0x2c:
+	case 0x2d:
+	case 0x2e:
+	case 0x2f:
+	case 0x34:
+	case 0x35:
+	case 0x36:
+	case 0x37:
+		return 9;
+	case 0x3c:
+	case 0x3d:
+	case 0x3e:
+	case 0x3f:
+		return 12;
+	default:
+		return 1;
+	}
+}
+
+/*
+follows the packet framing of gpu_execute() as words are queued, so the status bits that
+GP0 commands change (draw mode, mask setting and the frame buffer read flag) can be read
+back without waiting for the worker. It is resynchronised from the decoder in fifo_sync().
+*/
+
+void psxgpu_device::status_track( UINT32 data )
+{
+	m_status_entry[ m_status_offset ] = data;
+
+	UINT32 n_command = m_status_entry[ 0 ] >> 24;
+	UINT32 n_last = gp0_packet_words( n_command ) - 1;
+	switch( n_command )
+	{
+	case 0x48:
+	case 0x4a:
+	case 0x4c:
+	case 0x4e:
+		if( m_status_offset < n_last )
+		{
+			m_status_offset++;
+		}
+		else
+		{
+			m_status_offset = ( ( m_status_entry[ 3 ] & 0xf000f000 ) != 0x50005000 ) ? 3 : 0;
+		}
+		break;
+	case 0x58:
+	case 0x5a:
+	case 0x5c:
+	case 0x5e:
+		if( m_status_offset < n_last &&
+			( m_status_offset != 4 || ( m_status_entry[ 4 ] & 0xf000f000 ) != 0x50005000 ) )
+		{
+			m_status_offset++;
+		}
+		else
+		{
+			m_status_offset = ( ( m_status_entry[ 4 ] & 0xf000f000 ) != 0x50005000 ) ? 4 : 0;
+		}
+		break;
+	case 0xa0:
+		if( m_status_offset < n_last )
+		{
+			m_status_offset++;
+			if( m_status_offset == n_last )
+			{
+				m_status_pixels = std::max<UINT32>( m_status_entry[ 2 ] & 0xffff, 1 ) * std::max<UINT32>( m_status_entry[ 2 ] >> 16, 1 );
+			}
+		}
+		else if( m_status_pixels > 2 )
+		{
+			m_status_pixels -= 2;
+		}
+		else
+		{
+			m_status_offset = 0;
+		}
+		break;
+	case 0xc0:
+		if( m_status_offset < n_last )
+		{
+			m_status_offset++;
+		}
+		else
+		{
+			m_status_shadow |= ( 1L << 0x1b );
+		}
+		break;
+	case 0xe1:
+		m_status_shadow = tpage_status( m_status_shadow, data & 0xffffff );
+		break;
+	case 0xe6:
+		m_status_shadow &= ~( 3L << 0xb );
+		m_status_shadow |= ( data & 0x03 ) << 0xb;
+		break;
+	default:
+		if( m_status_offset < n_last )
+		{
+			m_status_offset++;
+			break;
+		}
+		m_status_offset = 0;
+
+		// textured polygons load the draw mode from the second vertex
+		if( ( n_command & 0xf4 ) == 0x24 )
+		{
+			m_status_shadow = tpage_status( m_status_shadow, m_status_entry[ 4 ] >> 16 );
+		}
+		else if( ( n_command & 0xf4 ) == 0x34 )
+		{
+			m_status_shadow = tpage_status( m_status_shadow, m_status_entry[ 5 ] >> 16 );
+		}
+		break;
+	}
+}
+
+void psxgpu_device::gpu_execute( UINT32 *p_ram, INT32 n_size )
 {
 	while( n_size > 0 )
 	{
@@ -3048,7 +3375,8 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 
 		verboselog( *this, 2, "PSX Packet #%u %08x\n", n_gpu_buffer_offset, data );
 		m_packet.n_entry[ n_gpu_buffer_offset ] = data;
-		switch( m_packet.n_entry[ 0 ] >> 24 )
+		UINT32 n_command = m_packet.n_entry[ 0 ] >> 24;
+		switch( n_command )
 		{
 		case 0x00:
 			verboselog( *this, 1, "not handled: GPU Command 0x00: (%08x)\n", data );
@@ -3057,7 +3385,7 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 			verboselog( *this, 1, "not handled: clear cache\n" );
 			break;
 		case 0x02:
-			if( n_gpu_buffer_offset < 2 )
+			if( n_gpu_buffer_offset < gp0_packet_words( n_command ) - 1 )
 			{
 				n_gpu_buffer_offset++;
 			}
@@ -3073,7 +3401,7 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 		case 0x21:
 		case 0x22:
 		case 0x23:
-			if( n_gpu_buffer_offset < 3 )
+			if( n_gpu_buffer_offset < gp0_packet_words( n_command ) - 1 )
 			{
 				n_gpu_buffer_offset++;
 			}
@@ -3088,7 +3416,7 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 		case 0x25:
 		case 0x26:
 		case 0x27:
-			if( n_gpu_buffer_offset < 6 )
+			if( n_gpu_buffer_offset < gp0_packet_words( n_command ) - 1 )
 			{
 				n_gpu_buffer_offset++;
 			}
@@ -3103,7 +3431,7 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 		case 0x29:
 		case 0x2a:
 		case 0x2b:
-			if( n_gpu_buffer_offset < 4 )
+			if( n_gpu_buffer_offset < gp0_packet_words( n_command ) - 1 )
 			{
 				n_gpu_buffer_offset++;
 			}
@@ -3118,7 +3446,7 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 		case 0x2d:
 		case 0x2e:
 		case 0x2f:
-			if( n_gpu_buffer_offset < 8 )
+			if( n_gpu_buffer_offset < gp0_packet_words( n_command ) - 1 )
 			{
 				n_gpu_buffer_offset++;
 			}
@@ -3133,7 +3461,7 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 		case 0x31:
 		case 0x32:
 		case 0x33:
-			if( n_gpu_buffer_offset < 5 )
+			if( n_gpu_buffer_offset < gp0_packet_words( n_command ) - 1 )
 			{
 				n_gpu_buffer_offset++;
 			}
@@ -3148,7 +3476,7 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 		case 0x35:
 		case 0x36:
 		case 0x37:
-			if( n_gpu_buffer_offset < 8 )
+			if( n_gpu_buffer_offset < gp0_packet_words( n_command ) - 1 )
 			{
 				n_gpu_buffer_offset++;
 			}
@@ -3163,7 +3491,7 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 		case 0x39:
 		case 0x3a:
 		case 0x3b:
-			if( n_gpu_buffer_offset < 7 )
+			if( n_gpu_buffer_offset < gp0_packet_words( n_command ) - 1 )
 			{
 				n_gpu_buffer_offset++;
 			}
@@ -3178,7 +3506,7 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 		case 0x3d:
 		case 0x3e:
 		case 0x3f:
-			if( n_gpu_buffer_offset < 11 )
+			if( n_gpu_buffer_offset < gp0_packet_words( n_command ) - 1 )
 			{
 				n_gpu_buffer_offset++;
 			}
@@ -3192,7 +3520,7 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 		case 0x40:
 		case 0x41:
 		case 0x42:
-			if( n_gpu_buffer_offset < 2 )
+			if( n_gpu_buffer_offset < gp0_packet_words( n_command ) - 1 )
 			{
 				n_gpu_buffer_offset++;
 			}
@@ -3207,7 +3535,7 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 		case 0x4a:
 		case 0x4c:
 		case 0x4e:
-			if( n_gpu_buffer_offset < 3 )
+			if( n_gpu_buffer_offset < gp0_packet_words( n_command ) - 1 )
 			{
 				n_gpu_buffer_offset++;
 			}
@@ -3231,7 +3559,7 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 		case 0x51:
 		case 0x52:
 		case 0x53:
-			if( n_gpu_buffer_offset < 3 )
+			if( n_gpu_buffer_offset < gp0_packet_words( n_command ) - 1 )
 			{
 				n_gpu_buffer_offset++;
 			}
@@ -3246,7 +3574,7 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 		case 0x5a:
 		case 0x5c:
 		case 0x5e:
-			if( n_gpu_buffer_offset < 5 &&
+			if( n_gpu_buffer_offset < gp0_packet_words( n_command ) - 1 &&
 				( n_gpu_buffer_offset != 4 || ( m_packet.n_entry[ 4 ] & 0xf000f000 ) != 0x50005000 ) )
 			{
 				n_gpu_buffer_offset++;
@@ -3273,7 +3601,7 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 		case 0x61:
 		case 0x62:
 		case 0x63:
-			if( n_gpu_buffer_offset < 2 )
+			if( n_gpu_buffer_offset < gp0_packet_words( n_command ) - 1 )
 			{
 				n_gpu_buffer_offset++;
 			}
@@ -3291,7 +3619,7 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 		case 0x65:
 		case 0x66:
 		case 0x67:
-			if( n_gpu_buffer_offset < 3 )
+			if( n_gpu_buffer_offset < gp0_packet_words( n_command ) - 1 )
 			{
 				n_gpu_buffer_offset++;
 			}
@@ -3308,7 +3636,7 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 			break;
 		case 0x68:
 		case 0x6a:
-			if( n_gpu_buffer_offset < 1 )
+			if( n_gpu_buffer_offset < gp0_packet_words( n_command ) - 1 )
 			{
 				n_gpu_buffer_offset++;
 			}
@@ -3325,7 +3653,7 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 		case 0x70:
 		case 0x71:
 			/* 8*8 rectangle */
-			if( n_gpu_buffer_offset < 1 )
+			if( n_gpu_buffer_offset < gp0_packet_words( n_command ) - 1 )
 			{
 				n_gpu_buffer_offset++;
 			}
@@ -3341,7 +3669,7 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 		case 0x75:
 		case 0x76:
 		case 0x77:
-			if( n_gpu_buffer_offset < 2 )
+			if( n_gpu_buffer_offset < gp0_packet_words( n_command ) - 1 )
 			{
 				n_gpu_buffer_offset++;
 			}
@@ -3356,7 +3684,7 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 		case 0x78:
 		case 0x79:
 			/* 16*16 rectangle */
-			if( n_gpu_buffer_offset < 1 )
+			if( n_gpu_buffer_offset < gp0_packet_words( n_command ) - 1 )
 			{
 				n_gpu_buffer_offset++;
 			}
@@ -3372,7 +3700,7 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 		case 0x7d:
 		case 0x7e:
 		case 0x7f:
-			if( n_gpu_buffer_offset < 2 )
+			if( n_gpu_buffer_offset < gp0_packet_words( n_command ) - 1 )
 			{
 				n_gpu_buffer_offset++;
 			}
@@ -3385,7 +3713,7 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 			}
 			break;
 		case 0x80:
-			if( n_gpu_buffer_offset < 3 )
+			if( n_gpu_buffer_offset < gp0_packet_words( n_command ) - 1 )
 			{
 				n_gpu_buffer_offset++;
 			}
@@ -3397,7 +3725,7 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 			}
 			break;
 		case 0xa0:
-			if( n_gpu_buffer_offset < 3 )
+			if( n_gpu_buffer_offset < gp0_packet_words( n_command ) - 1 )
 			{
 				n_gpu_buffer_offset++;
 			}
@@ -3436,7 +3764,7 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 			}
 			break;
 		case 0xc0:
-			if( n_gpu_buffer_offset < 2 )
+			if( n_gpu_buffer_offset < gp0_packet_words( n_command ) - 1 )
 			{
 				n_gpu_buffer_offset++;
 			}
@@ -3512,7 +3840,10 @@ void psxgpu_device::gpu_write( UINT32 *p_ram, INT32 n_size )
 			break;
 		default:
 #if defined( MAME_DEBUG )
-			popmessage( "unknown GPU packet %08x", m_packet.n_entry[ 0 ] );
+			if( std::this_thread::get_id() == m_main_thread )
+			{
+				popmessage( "unknown GPU packet %08x", m_packet.n_entry[ 0 ] );
+			}
 #endif
 			verboselog( *this, 0, "unknown GPU packet %08x (%08x)\n", m_packet.n_entry[ 0 ], data );
 #if ( STOP_ON_ERROR )
@@ -3533,6 +3864,7 @@ WRITE32_MEMBER( psxgpu_device::write )
 		gpu_write( &data, 1 );
 		break;
 	case 0x01:
+		fifo_sync();
 		switch( data >> 24 )
 		{
 		case 0x00:
@@ -3660,6 +3992,7 @@ WRITE32_MEMBER( psxgpu_device::write )
 			verboselog( *this, 0, "gpu_w( %08x ) unknown GPU command\n", data );
 			break;
 		}
+		status_sync();
 		break;
 	default:
 		verboselog( *this, 0, "gpu_w( %08x, %08x, %08x ) unknown register\n", offset, data, mem_mask );
@@ -3675,6 +4008,8 @@ void psxgpu_device::dma_read( UINT32 *p_n_psxram, UINT32 n_address, INT32 n_size
 
 void psxgpu_device::gpu_read( UINT32 *p_ram, INT32 n_size )
 {
+	fifo_sync();
+
 	while( n_size > 0 )
 	{
 		if( ( n_gpustatus & ( 1L << 0x1b ) ) != 0 )
@@ -3719,6 +4054,8 @@ void psxgpu_device::gpu_read( UINT32 *p_ram, INT32 n_size )
 		p_ram++;
 		n_size--;
 	}
+
+	status_sync();
 }
 
 READ32_MEMBER( psxgpu_device::read )
@@ -3731,7 +4068,7 @@ READ32_MEMBER( psxgpu_device::read )
 		gpu_read( &data, 1 );
 		break;
 	case 0x01:
-		data = n_gpustatus;
+		data = ( m_fifo_queue != nullptr ) ? m_status_shadow : n_gpustatus;
 		verboselog( *this, 1, "read GPU status (%08x)\n", data );
 		break;
 	default:
@@ -3750,7 +4087,9 @@ void psxgpu_device::vblank(screen_device &screen, bool vblank_state)
 		DebugCheckKeys();
 #endif
 
+		fifo_sync();
 		n_gpustatus ^= ( 1L << 31 );
+		status_sync();
 		m_vblank_handler(1);
 	}
 }
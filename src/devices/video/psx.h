@@ -14,6 +14,8 @@
 
 #include "emu.h"
 
+#include <thread>
+
 #define MCFG_PSX_GPU_VBLANK_HANDLER(_devcb) \
 	devcb = &psxgpu_device::set_vblank_handler(*device, DEVCB_##_devcb);
 
@@ -208,9 +210,11 @@ public:
 protected:
 	virtual void device_start() override;
 	virtual void device_reset() override;
+	virtual void device_stop() override;
 
 private:
 	void updatevisiblearea();
+	UINT32 tpage_status( UINT32 status, UINT32 tpage ) const;
 	void decode_tpage( UINT32 tpage );
 	void FlatPolygon( int n_points );
 	void FlatTexturedPolygon( int n_points );
@@ -231,6 +235,14 @@ private:
 	void gpu_reset();
 	void gpu_read( UINT32 *p_ram, INT32 n_size );
 	void gpu_write( UINT32 *p_ram, INT32 n_size );
+	void gpu_execute( UINT32 *p_ram, INT32 n_size );
+	void fifo_flush();
+	void fifo_sync();
+	void status_sync();
+	void status_track( UINT32 data );
+	static UINT32 gp0_packet_words( UINT32 n_command );
+	static void ATTR_PRINTF(3,4) verboselog( psxgpu_device &device, int n_level, const char *s_fmt, ... );
+	static void *fifo_callback( void *param, int threadid );
 
 	INT32 m_n_tx;
 	INT32 m_n_ty;
@@ -303,6 +315,15 @@ private:
 
 	devcb_write_line m_vblank_handler;
 
+	osd_work_queue *m_fifo_queue;
+	std::vector<UINT32> m_fifo;
+	std::thread::id m_main_thread;
+	std::string m_fifo_log;
+	UINT32 m_status_shadow;
+	UINT32 m_status_offset;
+	UINT32 m_status_entry[ 16 ];
+	UINT32 m_status_pixels;
+
 #if defined(DEBUG_VIEWER) && DEBUG_VIEWER
 	required_device<screen_device> m_screen;
 	void DebugMeshInit( void );
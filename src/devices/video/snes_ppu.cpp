@@ -395,6 +395,15 @@ void snes_ppu_device::device_reset()
 			m_mosaic_table[j][i] = (i / (j + 1)) * (j + 1);
 	}
 
+	/* Inititialize bitplane table: byte n of the entry holds bit (7 - n) of the plane byte */
+	for (int i = 0; i < 256; i++)
+	{
+		m_planar_table[i] = 0;
+		for (int n = 0; n < 8; n++)
+			m_planar_table[i] |= (UINT64)BIT(i, 7 - n) << (n * 8);
+	}
+	m_tile_cache_addr = ~0;
+
 	/* Init VRAM */
 	memset(m_vram.get(), 0, SNES_VRAM_SIZE);
 
@@ -642,19 +651,30 @@ inline void snes_ppu_device::draw_oamtile( INT16 ii, UINT8 colour, UINT16 pal, U
 
 inline void snes_ppu_device::draw_tile( UINT8 planes, UINT8 layer, UINT32 tileaddr, INT16 x, UINT8 priority, UINT8 flip, UINT8 direct_colors, UINT16 pal, UINT8 hires )
 {
-	UINT8 plane[8];
+	UINT64 row;
 	INT16 ii, jj;
 	int x_mos;
 
-	for (ii = 0; ii < planes / 2; ii++)
+	/* decode all 8 pixels of the row at once, one byte per pixel; the last decoded row is kept
+	   since VRAM can't change while a line is drawn and blank/repeated tiles are common */
+	if (tileaddr == m_tile_cache_addr && planes == m_tile_cache_planes)
+		row = m_tile_cache_row;
+	else
 	{
-		plane[2 * ii + 0] = m_vram[(tileaddr + 16 * ii + 0) % SNES_VRAM_SIZE];
-		plane[2 * ii + 1] = m_vram[(tileaddr + 16 * ii + 1) % SNES_VRAM_SIZE];
+		row = 0;
+		for (jj = 0; jj < planes / 2; jj++)
+		{
+			row |= m_planar_table[m_vram[(tileaddr + 16 * jj + 0) % SNES_VRAM_SIZE]] << (2 * jj + 0);
+			row |= m_planar_table[m_vram[(tileaddr + 16 * jj + 1) % SNES_VRAM_SIZE]] << (2 * jj + 1);
+		}
+		m_tile_cache_addr = tileaddr;
+		m_tile_cache_planes = planes;
+		m_tile_cache_row = row;
 	}
 
 	for (ii = x; ii < (x + 8); ii++)
 	{
-		UINT8 colour = 0;
+		UINT8 colour;
 		UINT8 mosaic = m_layer[layer].mosaic_enabled;
 
 #if SNES_LAYER_DEBUG
@@ -663,15 +683,9 @@ inline void snes_ppu_device::draw_tile( UINT8 planes, UINT8 layer, UINT32 tilead
 #endif /* SNES_LAYER_DEBUG */
 
 		if (flip)
-		{
-			for (jj = 0; jj < planes; jj++)
-				colour |= BIT(plane[jj], ii - x) ? (1 << jj) : 0;
-		}
+			colour = row >> ((7 - (ii - x)) * 8);
 		else
-		{
-			for (jj = 0; jj < planes; jj++)
-				colour |= BIT(plane[jj], 7 - (ii - x)) ? (1 << jj) : 0;
-		}
+			colour = row >> ((ii - x) * 8);
 
 		if (layer == SNES_OAM)
 			draw_oamtile(ii, colour, pal, priority);
@@ -1707,9 +1721,10 @@ inline void snes_ppu_device::draw_blend( UINT16 offset, UINT16 *colour, UINT8 pr
 		(prevent_color_math == SNES_CLIP_IN  && !m_clipmasks[SNES_COLOR][offset]) ||
 		(prevent_color_math == SNES_CLIP_OUT && m_clipmasks[SNES_COLOR][offset]))
 	{
-		UINT16 r, g, b;
 		struct SNES_SCANLINE *subscreen;
-		int clip_max = 0;   // if add then clip to 0x1f, if sub then clip to 0
+		UINT16 x = *colour & 0x7fff;
+		UINT16 y;
+		int halve;
 
 #if SNES_LAYER_DEBUG
 		/* Toggle drawing of SNES_SUBSCREEN or SNES_MAINSCREEN */
@@ -1725,70 +1740,39 @@ inline void snes_ppu_device::draw_blend( UINT16 offset, UINT16 *colour, UINT8 pr
 
 		if (m_sub_add_mode) /* SNES_SUBSCREEN*/
 		{
-			if (!BIT(m_color_modes, 7))
-			{
-				/* 0x00 add */
-				r = (*colour & 0x1f) + (subscreen->buffer[offset] & 0x1f);
-				g = ((*colour & 0x3e0) >> 5) + ((subscreen->buffer[offset] & 0x3e0) >> 5);
-				b = ((*colour & 0x7c00) >> 10) + ((subscreen->buffer[offset] & 0x7c00) >> 10);
-				clip_max = 1;
-			}
-			else
-			{
-				/* 0x80 sub */
-				r = (*colour & 0x1f) - (subscreen->buffer[offset] & 0x1f);
-				g = ((*colour & 0x3e0) >> 5) - ((subscreen->buffer[offset] & 0x3e0) >> 5);
-				b = ((*colour & 0x7c00) >> 10) - ((subscreen->buffer[offset] & 0x7c00) >> 10);
-				if (r > 0x1f) r = 0;
-				if (g > 0x1f) g = 0;
-				if (b > 0x1f) b = 0;
-			}
+			y = subscreen->buffer[offset] & 0x7fff;
 			/* only halve if the color is not the back colour */
-			if (BIT(m_color_modes, 6) && (subscreen->buffer[offset] != m_cgram[FIXED_COLOUR]))
-			{
-				r >>= 1;
-				g >>= 1;
-				b >>= 1;
-			}
+			halve = BIT(m_color_modes, 6) && (subscreen->buffer[offset] != m_cgram[FIXED_COLOUR]);
 		}
 		else /* Fixed colour */
 		{
-			if (!BIT(m_color_modes, 7))
-			{
-				/* 0x00 add */
-				r = (*colour & 0x1f) + (m_cgram[FIXED_COLOUR] & 0x1f);
-				g = ((*colour & 0x3e0) >> 5) + ((m_cgram[FIXED_COLOUR] & 0x3e0) >> 5);
-				b = ((*colour & 0x7c00) >> 10) + ((m_cgram[FIXED_COLOUR] & 0x7c00) >> 10);
-				clip_max = 1;
-			}
+			y = m_cgram[FIXED_COLOUR] & 0x7fff;
+			halve = BIT(m_color_modes, 6);
+		}
+
+		/* all three 5-bit components are added/subtracted at once, the carry/borrow out of each one is
+		   turned into a saturation mask. according to anomie's docs, after addition has been performed,
+		   division by 2 happens *before* clipping to max, and subtraction clips to 0 before halving */
+		if (!BIT(m_color_modes, 7))
+		{
+			/* 0x00 add */
+			if (halve)
+				*colour = (x + y - ((x ^ y) & 0x0421)) >> 1;
 			else
 			{
-				/* 0x80: sub */
-				r = (*colour & 0x1f) - (m_cgram[FIXED_COLOUR] & 0x1f);
-				g = ((*colour & 0x3e0) >> 5) - ((m_cgram[FIXED_COLOUR] & 0x3e0) >> 5);
-				b = ((*colour & 0x7c00) >> 10) - ((m_cgram[FIXED_COLOUR] & 0x7c00) >> 10);
-				if (r > 0x1f) r = 0;
-				if (g > 0x1f) g = 0;
-				if (b > 0x1f) b = 0;
-			}
-			/* halve if necessary */
-			if (BIT(m_color_modes, 6))
-			{
-				r >>= 1;
-				g >>= 1;
-				b >>= 1;
+				UINT32 sum = x + y;
+				UINT32 carry = (sum - ((x ^ y) & 0x0421)) & 0x8420;
+				*colour = (sum - carry) | (carry - (carry >> 5));
 			}
 		}
-
-		/* according to anomie's docs, after addition has been performed, division by 2 happens *before* clipping to max, hence we clip now */
-		if (clip_max)
+		else
 		{
-			if (r > 0x1f) r = 0x1f;
-			if (g > 0x1f) g = 0x1f;
-			if (b > 0x1f) b = 0x1f;
+			/* 0x80 sub */
+			UINT32 diff = x - y + 0x8420;
+			UINT32 borrow = (diff - ((x ^ y) & 0x8420)) & 0x8420;
+			UINT32 res = (diff - borrow) & (borrow - (borrow >> 5));
+			*colour = halve ? (res & 0x7bde) >> 1 : res;
 		}
-
-		*colour = ((r & 0x1f) | ((g & 0x1f) << 5) | ((b & 0x1f) << 10));
 	}
 }
 
@@ -1819,6 +1803,7 @@ void snes_ppu_device::refresh_scanline( bitmap_rgb32 &bitmap, UINT16 curline )
 	struct SNES_SCANLINE *scanline1, *scanline2;
 	UINT16 c;
 	UINT16 prev_colour = 0;
+	UINT8 fade_table[32];
 	int blurring = read_safe(machine().root_device().ioport("OPTIONS"), 0) & 0x01;
 
 	g_profiler.start(PROFILER_VIDEO);
@@ -1848,16 +1833,16 @@ void snes_ppu_device::refresh_scanline( bitmap_rgb32 &bitmap, UINT16 curline )
 		memset(m_scanlines[SNES_SUBSCREEN].blend_exception, 0, SNES_SCR_WIDTH);
 
 		/* Draw back colour */
+		UINT16 sub_back = (m_mode == 5 || m_mode == 6 || m_pseudo_hires) ? m_cgram[0] : m_cgram[FIXED_COLOUR];
 		for (ii = 0; ii < SNES_SCR_WIDTH; ii++)
 		{
-			if (m_mode == 5 || m_mode == 6 || m_pseudo_hires)
-				m_scanlines[SNES_SUBSCREEN].buffer[ii] = m_cgram[0];
-			else
-				m_scanlines[SNES_SUBSCREEN].buffer[ii] = m_cgram[FIXED_COLOUR];
-
+			m_scanlines[SNES_SUBSCREEN].buffer[ii] = sub_back;
 			m_scanlines[SNES_MAINSCREEN].buffer[ii] = m_cgram[0];
 		}
 
+		/* decoded rows are only valid for the current line */
+		m_tile_cache_addr = ~0;
+
 		/* Prepare OAM for this scanline */
 		update_objects_rto(curline);
 
@@ -1889,12 +1874,14 @@ void snes_ppu_device::refresh_scanline( bitmap_rgb32 &bitmap, UINT16 curline )
 		/* Draw the scanline to screen */
 
 		fade = m_screen_brightness;
+		for (x = 0; x < 32; x++)
+			fade_table[x] = pal5bit((x * fade) >> 4);
+
+		int hires = (m_mode != 5 && m_mode != 6 && !m_pseudo_hires) ? 0 : 1;
 
 		for (x = 0; x < SNES_SCR_WIDTH; x++)
 		{
-			int r, g, b, hires;
 			UINT16 tmp_col[2];
-			hires = (m_mode != 5 && m_mode != 6 && !m_pseudo_hires) ? 0 : 1;
 
 			/* in hires, the first pixel (of 512) is subscreen pixel, then the first mainscreen pixel follows, and so on... */
 			if (!hires)
@@ -1905,12 +1892,10 @@ void snes_ppu_device::refresh_scanline( bitmap_rgb32 &bitmap, UINT16 curline )
 				if (!scanline1->blend_exception[x] && m_layer[scanline1->layer[x]].color_math)
 					draw_blend(x, &c, m_prevent_color_math, m_clip_to_black, 0);
 
-				r = ((c & 0x1f) * fade) >> 4;
-				g = (((c & 0x3e0) >> 5) * fade) >> 4;
-				b = (((c & 0x7c00) >> 10) * fade) >> 4;
+				rgb_t rgb(fade_table[c & 0x1f], fade_table[(c & 0x3e0) >> 5], fade_table[(c & 0x7c00) >> 10]);
 
-				bitmap.pix32(curline, x * 2 + 0) = rgb_t(pal5bit(r), pal5bit(g), pal5bit(b));
-				bitmap.pix32(curline, x * 2 + 1) = rgb_t(pal5bit(r), pal5bit(g), pal5bit(b));
+				bitmap.pix32(curline, x * 2 + 0) = rgb;
+				bitmap.pix32(curline, x * 2 + 1) = rgb;
 			}
 			else
 			{
@@ -1944,11 +1929,7 @@ void snes_ppu_device::refresh_scanline( bitmap_rgb32 &bitmap, UINT16 curline )
 				else
 					c = tmp_col[0];
 
-				r = ((c & 0x1f) * fade) >> 4;
-				g = (((c & 0x3e0) >> 5) * fade) >> 4;
-				b = (((c & 0x7c00) >> 10) * fade) >> 4;
-
-				bitmap.pix32(curline, x * 2 + 0) = rgb_t(pal5bit(r), pal5bit(g), pal5bit(b));
+				bitmap.pix32(curline, x * 2 + 0) = rgb_t(fade_table[c & 0x1f], fade_table[(c & 0x3e0) >> 5], fade_table[(c & 0x7c00) >> 10]);
 				prev_colour = tmp_col[0];
 
 				/* average the second pixel if required, or draw it directly*/
@@ -1957,11 +1938,7 @@ void snes_ppu_device::refresh_scanline( bitmap_rgb32 &bitmap, UINT16 curline )
 				else
 					c = tmp_col[1];
 
-				r = ((c & 0x1f) * fade) >> 4;
-				g = (((c & 0x3e0) >> 5) * fade) >> 4;
-				b = (((c & 0x7c00) >> 10) * fade) >> 4;
-
-				bitmap.pix32(curline, x * 2 + 1) = rgb_t(pal5bit(r), pal5bit(g), pal5bit(b));
+				bitmap.pix32(curline, x * 2 + 1) = rgb_t(fade_table[c & 0x1f], fade_table[(c & 0x3e0) >> 5], fade_table[(c & 0x7c00) >> 10]);
 				prev_colour = tmp_col[1];
 			}
 		}
@@ -198,6 +198,10 @@ public:
 	UINT8 m_window1_left, m_window1_right, m_window2_left, m_window2_right;
 
 	UINT16 m_mosaic_table[16][4096];
+	UINT64 m_planar_table[256];
+	UINT32 m_tile_cache_addr;
+	UINT8 m_tile_cache_planes;
+	UINT64 m_tile_cache_row;
 	UINT8 m_clipmasks[6][SNES_SCR_WIDTH];
 	UINT8 m_update_windows;
 	UINT8 m_update_offsets;
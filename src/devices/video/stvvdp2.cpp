@@ -4512,18 +4512,12 @@ void saturn_state::stv_vdp2_copy_roz_bitmap(bitmap_rgb32 &bitmap,
 										int planerenderedsizex,
 										int planerenderedsizey)
 {
-	INT32 xsp, ysp, xp, yp, dx, dy, x, y, xs, ys, dxs, dys;
-	INT32 vcnt, hcnt;
+	INT32 xp, yp, dx, dy;
 	INT32 kx, ky;
 	INT8  use_coeff_table, coeff_table_mode, coeff_table_size, coeff_table_shift;
 	INT8  screen_over_process;
 	UINT8 vcnt_shift, hcnt_shift;
-	UINT8 coeff_msb;
 	UINT32 *coeff_table_base, coeff_table_offset;
-	INT32 coeff_table_val;
-	UINT32 address;
-	UINT32 *line;
-	rgb_t pix;
 	//UINT32 coeff_line_color_screen_data;
 	INT32 clipxmask = 0, clipymask = 0;
 
@@ -4541,7 +4535,6 @@ void saturn_state::stv_vdp2_copy_roz_bitmap(bitmap_rgb32 &bitmap,
 
 	use_coeff_table = coeff_table_mode = coeff_table_size = coeff_table_shift = 0;
 	coeff_table_offset = 0;
-	coeff_table_val = 0;
 	coeff_table_base = nullptr;
 
 	if ( LOG_ROZ == 1 ) logerror( "Rendering RBG with parameter %s\n", iRP == 1 ? "A" : "B" );
@@ -4639,7 +4632,169 @@ void saturn_state::stv_vdp2_copy_roz_bitmap(bitmap_rgb32 &bitmap,
 	xp = mul_fixed32( RP.A, RP.px - RP.cx ) + mul_fixed32( RP.B, RP.py - RP.cy ) + mul_fixed32( RP.C, RP.pz - RP.cz ) + RP.cx + RP.mx;
 	yp = mul_fixed32( RP.D, RP.px - RP.cx ) + mul_fixed32( RP.E, RP.py - RP.cy ) + mul_fixed32( RP.F, RP.pz - RP.cz ) + RP.cy + RP.my;
 
-	for (vcnt = cliprect.min_y; vcnt <= cliprect.max_y; vcnt++ )
+	stv_vdp2_roz_job &job = m_vdp2.roz_job;
+	job.state = this;
+	job.bitmap = &bitmap;
+	job.roz_bitmap = &roz_bitmap;
+	job.min_x = cliprect.min_x;
+	job.max_x = cliprect.max_x;
+	job.vcnt_shift = vcnt_shift;
+	job.hcnt_shift = hcnt_shift;
+	job.planerenderedsizex = planerenderedsizex;
+	job.planerenderedsizey = planerenderedsizey;
+	job.clipxmask = clipxmask;
+	job.clipymask = clipymask;
+	job.use_coeff_table = use_coeff_table;
+	job.coeff_table_mode = coeff_table_mode;
+	job.coeff_table_size = coeff_table_size;
+	job.coeff_table_base = coeff_table_base;
+	job.coeff_table_offset = coeff_table_offset;
+	job.kx = kx;
+	job.ky = ky;
+	job.dx = dx;
+	job.dy = dy;
+	job.xp = xp;
+	job.yp = yp;
+	job.transparency = stv2_current_tilemap.transparency;
+	job.fade_control = stv2_current_tilemap.fade_control;
+	job.alpha = stv2_current_tilemap.alpha;
+
+	/* every line only depends on the rotation parameters, so split the screen into bands and let the work queue have them */
+	int lines = cliprect.max_y - cliprect.min_y + 1;
+
+	if ( m_vdp2.roz_queue != nullptr && lines >= STV_VDP2_ROZ_BANDS * 8 )
+	{
+		for ( int band = 0; band < STV_VDP2_ROZ_BANDS; band++ )
+		{
+			m_vdp2.roz_band[band].job = &job;
+			m_vdp2.roz_band[band].min_y = cliprect.min_y + (lines * band) / STV_VDP2_ROZ_BANDS;
+			m_vdp2.roz_band[band].max_y = cliprect.min_y + (lines * (band + 1)) / STV_VDP2_ROZ_BANDS - 1;
+			m_vdp2.roz_band[band].done = false;
+		}
+
+		/* auto-released items can't report queueing failures, so copy whatever didn't get done here */
+		osd_work_item_queue_multiple(m_vdp2.roz_queue, stv_vdp2_roz_band_callback, STV_VDP2_ROZ_BANDS, m_vdp2.roz_band, sizeof(m_vdp2.roz_band[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		osd_work_queue_wait(m_vdp2.roz_queue, WORK_QUEUE_WAIT_INFINITE);
+		for ( int band = 0; band < STV_VDP2_ROZ_BANDS; band++ )
+		{
+			if ( !m_vdp2.roz_band[band].done )
+				stv_vdp2_copy_roz_lines(job, m_vdp2.roz_band[band].min_y, m_vdp2.roz_band[band].max_y);
+		}
+	}
+	else
+		stv_vdp2_copy_roz_lines(job, cliprect.min_y, cliprect.max_y);
+}
+
+void *saturn_state::stv_vdp2_roz_band_callback(void *param, int threadid)
+{
+	stv_vdp2_roz_band *band = (stv_vdp2_roz_band *)param;
+
+	band->job->state->stv_vdp2_copy_roz_lines(*band->job, band->min_y, band->max_y);
+	band->done = true;
+	return nullptr;
+}
+
+inline void saturn_state::stv_vdp2_roz_plot(const stv_vdp2_roz_job &job, UINT32 *dest, rgb_t pix)
+{
+	switch( job.transparency )
+	{
+		case STV_TRANSPARENCY_PEN:
+			if (pix & 0xffffff)
+			{
+				if(job.fade_control & 1)
+					stv_vdp2_compute_color_offset_UINT32(&pix,job.fade_control & 2);
+
+				*dest = pix;
+			}
+			break;
+		case STV_TRANSPARENCY_NONE:
+			if(job.fade_control & 1)
+				stv_vdp2_compute_color_offset_UINT32(&pix,job.fade_control & 2);
+
+			*dest = pix;
+			break;
+		case STV_TRANSPARENCY_ALPHA:
+			if (pix & 0xffffff)
+			{
+				if(job.fade_control & 1)
+					stv_vdp2_compute_color_offset_UINT32(&pix,job.fade_control & 2);
+
+				*dest = alpha_blend_r32( *dest, pix, job.alpha );
+			}
+			break;
+		case STV_TRANSPARENCY_ADD_BLEND:
+			if (pix & 0xffffff)
+			{
+				if(job.fade_control & 1)
+					stv_vdp2_compute_color_offset_UINT32(&pix,job.fade_control & 2);
+
+				*dest = stv_add_blend( *dest, pix );
+			}
+			break;
+	}
+}
+
+inline bool saturn_state::stv_vdp2_roz_read_coeff(const stv_vdp2_roz_job &job, UINT32 kaddr, INT32 *coeff)
+{
+	UINT32 address;
+	INT32 coeff_table_val;
+	UINT8 coeff_msb;
+
+	switch( job.coeff_table_size )
+	{
+		case 0:
+			address = job.coeff_table_offset + (kaddr >> 16) * 4;
+			coeff_table_val = job.coeff_table_base[ address / 4 ];
+			//coeff_line_color_screen_data = (coeff_table_val & 0x7f000000) >> 24;
+			coeff_msb = (coeff_table_val & 0x80000000) > 0;
+			if ( coeff_table_val & 0x00800000 )
+			{
+				coeff_table_val |= 0xff000000;
+			}
+			else
+			{
+				coeff_table_val &= 0x007fffff;
+			}
+			break;
+		case 1:
+			address = job.coeff_table_offset + (kaddr >> 16) * 2;
+			coeff_table_val = job.coeff_table_base[ address / 4 ];
+			if ( (address & 2) == 0 )
+			{
+				coeff_table_val >>= 16;
+			}
+			coeff_table_val &= 0xffff;
+			//coeff_line_color_screen_data = 0;
+			coeff_msb = (coeff_table_val & 0x8000) > 0;
+			if ( coeff_table_val & 0x4000 )
+			{
+				coeff_table_val |= 0xffff8000;
+			}
+			else
+			{
+				coeff_table_val &= 0x3fff;
+			}
+			coeff_table_val <<= 6; /* to form 16.16 fixed point val */
+			break;
+		default:
+			return false;
+	}
+
+	*coeff = coeff_table_val;
+	return !coeff_msb;
+}
+
+void saturn_state::stv_vdp2_copy_roz_lines(const stv_vdp2_roz_job &job, int min_y, int max_y)
+{
+	INT32 xsp, ysp, x, y, xs, ys, dxs, dys;
+	INT32 vcnt, hcnt;
+	INT32 kx = job.kx, ky = job.ky, xp = job.xp;
+	INT32 coeff_table_val;
+	UINT32 kaddr;
+	UINT32 *line;
+	bitmap_rgb32 &roz_bitmap = *job.roz_bitmap;
+
+	for (vcnt = min_y; vcnt <= max_y; vcnt++ )
 	{
 		/*xsp = RP.A * ( ( RP.xst + RP.dxst * (vcnt << 16) ) - RP.px ) +
 		      RP.B * ( ( RP.yst + RP.dyst * (vcnt << 16) ) - RP.py ) +
@@ -4647,66 +4802,23 @@ void saturn_state::stv_vdp2_copy_roz_bitmap(bitmap_rgb32 &bitmap,
 		ysp = RP.D * ( ( RP.xst + RP.dxst * (vcnt << 16) ) - RP.px ) +
 		      RP.E * ( ( RP.yst + RP.dyst * (vcnt << 16) ) - RP.py ) +
 		      RP.F * ( RP.zst - RP.pz );*/
-		xsp = mul_fixed32( RP.A, RP.xst + mul_fixed32( RP.dxst, vcnt << (16 - vcnt_shift)) - RP.px ) +
-				mul_fixed32( RP.B, RP.yst + mul_fixed32( RP.dyst, vcnt << (16 - vcnt_shift)) - RP.py ) +
+		xsp = mul_fixed32( RP.A, RP.xst + mul_fixed32( RP.dxst, vcnt << (16 - job.vcnt_shift)) - RP.px ) +
+				mul_fixed32( RP.B, RP.yst + mul_fixed32( RP.dyst, vcnt << (16 - job.vcnt_shift)) - RP.py ) +
 				mul_fixed32( RP.C, RP.zst - RP.pz );
-		ysp = mul_fixed32( RP.D, RP.xst + mul_fixed32( RP.dxst, vcnt << (16 - vcnt_shift)) - RP.px ) +
-				mul_fixed32( RP.E, RP.yst + mul_fixed32( RP.dyst, vcnt << (16 - vcnt_shift)) - RP.py ) +
+		ysp = mul_fixed32( RP.D, RP.xst + mul_fixed32( RP.dxst, vcnt << (16 - job.vcnt_shift)) - RP.px ) +
+				mul_fixed32( RP.E, RP.yst + mul_fixed32( RP.dyst, vcnt << (16 - job.vcnt_shift)) - RP.py ) +
 				mul_fixed32( RP.F, RP.zst - RP.pz );
-		//xp  = RP.A * ( RP.px - RP.cx ) + RP.B * ( RP.py - RP.cy ) + RP.C * ( RP.pz - RP.cz ) + RP.cx + RP.mx;
-		//yp  = RP.D * ( RP.px - RP.cx ) + RP.E * ( RP.py - RP.cy ) + RP.F * ( RP.pz - RP.cz ) + RP.cy + RP.my;
-		//dx  = (RP.A * RP.dx) + (RP.B * RP.dy);
-		//dy  = (RP.D * RP.dx) + (RP.E * RP.dy);
 
-		line = &bitmap.pix32(vcnt);
+		line = &job.bitmap->pix32(vcnt);
+		kaddr = RP.kast + RP.dkast*(vcnt>>job.vcnt_shift);
 
-		if ( !use_coeff_table || RP.dkax == 0 )
+		if ( !job.use_coeff_table || RP.dkax == 0 )
 		{
-			if ( use_coeff_table )
+			if ( job.use_coeff_table )
 			{
-				switch( coeff_table_size )
-				{
-					case 0:
-						address = coeff_table_offset + ((RP.kast + RP.dkast*(vcnt>>vcnt_shift)) >> 16) * 4;
-						coeff_table_val = coeff_table_base[ address / 4 ];
-						//coeff_line_color_screen_data = (coeff_table_val & 0x7f000000) >> 24;
-						coeff_msb = (coeff_table_val & 0x80000000) > 0;
-						if ( coeff_table_val & 0x00800000 )
-						{
-							coeff_table_val |= 0xff000000;
-						}
-						else
-						{
-							coeff_table_val &= 0x007fffff;
-						}
-						break;
-					case 1:
-						address = coeff_table_offset + ((RP.kast + RP.dkast*(vcnt>>vcnt_shift)) >> 16) * 2;
-						coeff_table_val = coeff_table_base[ address / 4 ];
-						if ( (address & 2) == 0 )
-						{
-							coeff_table_val >>= 16;
-						}
-						coeff_table_val &= 0xffff;
-						//coeff_line_color_screen_data = 0;
-						coeff_msb = (coeff_table_val & 0x8000) > 0;
-						if ( coeff_table_val & 0x4000 )
-						{
-							coeff_table_val |= 0xffff8000;
-						}
-						else
-						{
-							coeff_table_val &= 0x3fff;
-						}
-						coeff_table_val <<= 6; /* to form 16.16 fixed point val */
-						break;
-					default:
-						coeff_msb = 1;
-						break;
-				}
-				if ( coeff_msb ) continue;
+				if ( !stv_vdp2_roz_read_coeff(job, kaddr, &coeff_table_val) ) continue;
 
-				switch( coeff_table_mode )
+				switch( job.coeff_table_mode )
 				{
 					case 0:
 						kx = ky = coeff_table_val;
@@ -4726,102 +4838,29 @@ void saturn_state::stv_vdp2_copy_roz_bitmap(bitmap_rgb32 &bitmap,
 			//x = RP.kx * ( xsp + dx * (hcnt << 16)) + xp;
 			//y = RP.ky * ( ysp + dy * (hcnt << 16)) + yp;
 			xs = mul_fixed32( kx, xsp ) + xp;
-			ys = mul_fixed32( ky, ysp ) + yp;
-			dxs = mul_fixed32( kx, mul_fixed32( dx, 1 << (16-hcnt_shift)));
-			dys = mul_fixed32( ky, mul_fixed32( dy, 1 << (16-hcnt_shift)));
+			ys = mul_fixed32( ky, ysp ) + job.yp;
+			dxs = mul_fixed32( kx, mul_fixed32( job.dx, 1 << (16-job.hcnt_shift)));
+			dys = mul_fixed32( ky, mul_fixed32( job.dy, 1 << (16-job.hcnt_shift)));
 
-			for (hcnt = cliprect.min_x; hcnt <= cliprect.max_x; xs+=dxs, ys+=dys, hcnt++ )
+			for (hcnt = job.min_x; hcnt <= job.max_x; xs+=dxs, ys+=dys, hcnt++ )
 			{
 				x = xs >> 16;
 				y = ys >> 16;
 
-				if ( x & clipxmask || y & clipymask ) continue;
-				pix = roz_bitmap.pix32(y & planerenderedsizey, x & planerenderedsizex);
-				switch( stv2_current_tilemap.transparency )
-				{
-					case STV_TRANSPARENCY_PEN:
-						if (pix & 0xffffff)
-						{
-							if(stv2_current_tilemap.fade_control & 1)
-								stv_vdp2_compute_color_offset_UINT32(&pix,stv2_current_tilemap.fade_control & 2);
-
-							line[hcnt] = pix;
-						}
-						break;
-					case STV_TRANSPARENCY_NONE:
-						if(stv2_current_tilemap.fade_control & 1)
-							stv_vdp2_compute_color_offset_UINT32(&pix,stv2_current_tilemap.fade_control & 2);
-
-						line[hcnt] = pix;
-						break;
-					case STV_TRANSPARENCY_ALPHA:
-						if (pix & 0xffffff)
-						{
-							if(stv2_current_tilemap.fade_control & 1)
-								stv_vdp2_compute_color_offset_UINT32(&pix,stv2_current_tilemap.fade_control & 2);
-
-							line[hcnt] = alpha_blend_r32( line[hcnt], pix, stv2_current_tilemap.alpha );
-						}
-						break;
-					case STV_TRANSPARENCY_ADD_BLEND:
-						if (pix & 0xffffff)
-						{
-							if(stv2_current_tilemap.fade_control & 1)
-								stv_vdp2_compute_color_offset_UINT32(&pix,stv2_current_tilemap.fade_control & 2);
-
-							line[hcnt] = stv_add_blend( line[hcnt], pix );
-						}
-						break;
-				}
-
+				if ( x & job.clipxmask || y & job.clipymask ) continue;
+				stv_vdp2_roz_plot(job, &line[hcnt], roz_bitmap.pix32(y & job.planerenderedsizey, x & job.planerenderedsizex));
 			}
 		}
 		else
 		{
-			for (hcnt = cliprect.min_x; hcnt <= cliprect.max_x; hcnt++ )
+			/* the coefficient address and dx * (hcnt << 16) both step linearly across the line */
+			kaddr += RP.dkax*job.min_x;
+
+			for (hcnt = job.min_x; hcnt <= job.max_x; hcnt++, kaddr += RP.dkax )
 			{
-				switch( coeff_table_size )
-				{
-					case 0:
-						address = coeff_table_offset + ((RP.kast + RP.dkast*(vcnt>>vcnt_shift) + RP.dkax*hcnt) >> 16) * 4;
-						coeff_table_val = coeff_table_base[ address / 4 ];
-						//coeff_line_color_screen_data = (coeff_table_val & 0x7f000000) >> 24;
-						coeff_msb = (coeff_table_val & 0x80000000) > 0;
-						if ( coeff_table_val & 0x00800000 )
-						{
-							coeff_table_val |= 0xff000000;
-						}
-						else
-						{
-							coeff_table_val &= 0x007fffff;
-						}
-						break;
-					case 1:
-						address = coeff_table_offset + ((RP.kast + RP.dkast*(vcnt>>vcnt_shift) + RP.dkax*hcnt) >> 16) * 2;
-						coeff_table_val = coeff_table_base[ address / 4 ];
-						if ( (address & 2) == 0 )
-						{
-							coeff_table_val >>= 16;
-						}
-						coeff_table_val &= 0xffff;
-						//coeff_line_color_screen_data = 0;
-						coeff_msb = (coeff_table_val & 0x8000) > 0;
-						if ( coeff_table_val & 0x4000 )
-						{
-							coeff_table_val |= 0xffff8000;
-						}
-						else
-						{
-							coeff_table_val &= 0x3fff;
-						}
-						coeff_table_val <<= 6; /* to form 16.16 fixed point val */
-						break;
-					default:
-						coeff_msb = 1;
-						break;
-				}
-				if ( coeff_msb ) continue;
-				switch( coeff_table_mode )
+				if ( !stv_vdp2_roz_read_coeff(job, kaddr, &coeff_table_val) ) continue;
+
+				switch( job.coeff_table_mode )
 				{
 					case 0:
 						kx = ky = coeff_table_val;
@@ -4839,51 +4878,15 @@ void saturn_state::stv_vdp2_copy_roz_bitmap(bitmap_rgb32 &bitmap,
 
 				//x = RP.kx * ( xsp + dx * (hcnt << 16)) + xp;
 				//y = RP.ky * ( ysp + dy * (hcnt << 16)) + yp;
-				x = mul_fixed32( kx, xsp + mul_fixed32( dx, (hcnt>>hcnt_shift) << 16 ) ) + xp;
-				y = mul_fixed32( ky, ysp + mul_fixed32( dy, (hcnt>>hcnt_shift) << 16 ) ) + yp;
+				x = mul_fixed32( kx, xsp + job.dx * (hcnt>>job.hcnt_shift) ) + xp;
+				y = mul_fixed32( ky, ysp + job.dy * (hcnt>>job.hcnt_shift) ) + job.yp;
 
 				x >>= 16;
 				y >>= 16;
 
-				if ( x & clipxmask || y & clipymask ) continue;
-
-				pix = roz_bitmap.pix32(y & planerenderedsizey, x & planerenderedsizex);
-				switch( stv2_current_tilemap.transparency )
-				{
-					case STV_TRANSPARENCY_PEN:
-						if (pix & 0xffffff)
-						{
-							if(stv2_current_tilemap.fade_control & 1)
-								stv_vdp2_compute_color_offset_UINT32(&pix,stv2_current_tilemap.fade_control & 2);
-
-							line[hcnt] = pix;
-						}
-						break;
-					case STV_TRANSPARENCY_NONE:
-						if(stv2_current_tilemap.fade_control & 1)
-							stv_vdp2_compute_color_offset_UINT32(&pix,stv2_current_tilemap.fade_control & 2);
-
-						line[hcnt] = pix;
-						break;
-					case STV_TRANSPARENCY_ALPHA:
-						if (pix & 0xffffff)
-						{
-							if(stv2_current_tilemap.fade_control & 1)
-								stv_vdp2_compute_color_offset_UINT32(&pix,stv2_current_tilemap.fade_control & 2);
+				if ( x & job.clipxmask || y & job.clipymask ) continue;
 
-							line[hcnt] = alpha_blend_r32( line[hcnt], pix, stv2_current_tilemap.alpha );
-						}
-						break;
-					case STV_TRANSPARENCY_ADD_BLEND:
-						if (pix & 0xffffff)
-						{
-							if(stv2_current_tilemap.fade_control & 1)
-								stv_vdp2_compute_color_offset_UINT32(&pix,stv2_current_tilemap.fade_control & 2);
-
-							line[hcnt] = stv_add_blend( line[hcnt], pix );
-						}
-						break;
-				}
+				stv_vdp2_roz_plot(job, &line[hcnt], roz_bitmap.pix32(y & job.planerenderedsizey, x & job.planerenderedsizex));
 			}
 		}
 	}
@@ -6093,6 +6096,11 @@ void saturn_state::stv_vdp2_state_save_postload( void )
 
 void saturn_state::stv_vdp2_exit ( void )
 {
+	if (m_vdp2.roz_queue != nullptr)
+	{
+		osd_work_queue_free(m_vdp2.roz_queue);
+		m_vdp2.roz_queue = nullptr;
+	}
 	m_vdp2.roz_bitmap[0].reset();
 	m_vdp2.roz_bitmap[1].reset();
 }
@@ -6105,6 +6113,7 @@ int saturn_state::stv_vdp2_start ( void )
 	m_vdp2_vram = make_unique_clear<UINT32[]>(0x100000/4 );
 	m_vdp2_cram = make_unique_clear<UINT32[]>(0x080000/4 );
 	m_vdp2.gfx_decode = std::make_unique<UINT8[]>(0x100000 );
+	m_vdp2.roz_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
 
 //  m_gfxdecode->gfx(0)->granularity()=4;
 //  m_gfxdecode->gfx(1)->granularity()=4;
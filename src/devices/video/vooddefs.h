@@ -2658,14 +2658,12 @@ static inline bool ATTR_FORCE_INLINE combineColor(voodoo_device *vd, stats_block
 
 #define RASTERIZER(name, TMUS, FBZCOLORPATH, FBZMODE, ALPHAMODE, FOGMODE, TEXMODE0, TEXMODE1) \
 																				\
-void voodoo_device::raster_##name(void *destbase, INT32 y, const poly_extent *extent, const void *extradata, int threadid) \
+void voodoo_device::raster_##name(voodoo_device *vd, INT32 y, const voodoo_poly_manager::extent_t &extent, const poly_extra_data &extra, int threadid) \
 {                                                                               \
-	const poly_extra_data *extra = (const poly_extra_data *)extradata;          \
-	voodoo_device *vd = extra->device; \
 	stats_block *stats = &vd->thread_stats[threadid];                            \
 	DECLARE_DITHER_POINTERS;                                                    \
-	INT32 startx = extent->startx;                                              \
-	INT32 stopx = extent->stopx;                                                \
+	INT32 startx = extent.startx;                                              \
+	INT32 stopx = extent.stopx;                                                \
 	rgbaint_t iterargb, iterargbDelta;                                           \
 	INT32 iterz;                                                                \
 	INT64 iterw, iterw0 = 0, iterw1 = 0;                                        \
@@ -2717,33 +2715,33 @@ void voodoo_device::raster_##name(void *destbase, INT32 y, const poly_extent *ex
 	}                                                                           \
 																				\
 	/* get pointers to the target buffer and depth buffer */                    \
-	dest = (UINT16 *)destbase + scry * vd->fbi.rowpixels;                        \
+	dest = extra.destbase + scry * vd->fbi.rowpixels;                        \
 	depth = (vd->fbi.auxoffs != ~0) ? ((UINT16 *)(vd->fbi.ram + vd->fbi.auxoffs) + scry * vd->fbi.rowpixels) : nullptr; \
 																				\
 	/* compute the starting parameters */                                       \
-	dx = startx - (extra->ax >> 4);                                             \
-	dy = y - (extra->ay >> 4);                                                  \
-	INT32 iterr = extra->startr + dy * extra->drdy + dx * extra->drdx;                \
-	INT32 iterg = extra->startg + dy * extra->dgdy + dx * extra->dgdx;                \
-	INT32 iterb = extra->startb + dy * extra->dbdy + dx * extra->dbdx;                \
-	INT32 itera = extra->starta + dy * extra->dady + dx * extra->dadx;                \
+	dx = startx - (extra.ax >> 4);                                             \
+	dy = y - (extra.ay >> 4);                                                  \
+	INT32 iterr = extra.startr + dy * extra.drdy + dx * extra.drdx;                \
+	INT32 iterg = extra.startg + dy * extra.dgdy + dx * extra.dgdx;                \
+	INT32 iterb = extra.startb + dy * extra.dbdy + dx * extra.dbdx;                \
+	INT32 itera = extra.starta + dy * extra.dady + dx * extra.dadx;                \
 	iterargb.set(itera, iterr, iterg, iterb); \
-	iterargbDelta.set(extra->dadx, extra->drdx, extra->dgdx, extra->dbdx); \
-	iterz = extra->startz + dy * extra->dzdy + dx * extra->dzdx;                \
-	iterw = extra->startw + dy * extra->dwdy + dx * extra->dwdx;                \
+	iterargbDelta.set(extra.dadx, extra.drdx, extra.dgdx, extra.dbdx); \
+	iterz = extra.startz + dy * extra.dzdy + dx * extra.dzdx;                \
+	iterw = extra.startw + dy * extra.dwdy + dx * extra.dwdx;                \
 	if (TMUS >= 1)                                                              \
 	{                                                                           \
-		iterw0 = extra->startw0 + dy * extra->dw0dy +   dx * extra->dw0dx;      \
-		iters0 = extra->starts0 + dy * extra->ds0dy + dx * extra->ds0dx;        \
-		itert0 = extra->startt0 + dy * extra->dt0dy + dx * extra->dt0dx;        \
+		iterw0 = extra.startw0 + dy * extra.dw0dy +   dx * extra.dw0dx;      \
+		iters0 = extra.starts0 + dy * extra.ds0dy + dx * extra.ds0dx;        \
+		itert0 = extra.startt0 + dy * extra.dt0dy + dx * extra.dt0dx;        \
 	}                                                                           \
 	if (TMUS >= 2)                                                              \
 	{                                                                           \
-		iterw1 = extra->startw1 + dy * extra->dw1dy +   dx * extra->dw1dx;      \
-		iters1 = extra->starts1 + dy * extra->ds1dy + dx * extra->ds1dx;        \
-		itert1 = extra->startt1 + dy * extra->dt1dy + dx * extra->dt1dx;        \
+		iterw1 = extra.startw1 + dy * extra.dw1dy +   dx * extra.dw1dx;      \
+		iters1 = extra.starts1 + dy * extra.ds1dy + dx * extra.ds1dx;        \
+		itert1 = extra.startt1 + dy * extra.dt1dy + dx * extra.dt1dx;        \
 	}                                                                           \
-	extra->info->hits++;                                                        \
+	extra.info->hits++;                                                        \
 	/* loop in X */                                                             \
 	for (x = startx; x < stopx; x++)                                            \
 	{                                                                           \
@@ -2761,7 +2759,7 @@ void voodoo_device::raster_##name(void *destbase, INT32 y, const poly_extent *ex
 		if (TMUS >= 2 && vd->tmu[1].lodmin < (8 << 8))                    {       \
 			INT32 tmp; \
 			const rgbaint_t texelZero(0);  \
-			texel = genTexture(&vd->tmu[1], x, dither4, TEXMODE1, vd->tmu[1].lookup, extra->lodbase1, \
+			texel = genTexture(&vd->tmu[1], x, dither4, TEXMODE1, vd->tmu[1].lookup, extra.lodbase1, \
 														iters1, itert1, iterw1, tmp); \
 			texel = combineTexture(&vd->tmu[1], TEXMODE1, texel, texelZero, tmp); \
 		} \
@@ -2774,7 +2772,7 @@ void voodoo_device::raster_##name(void *destbase, INT32 y, const poly_extent *ex
 			{                                                                   \
 				INT32 lod0; \
 				rgbaint_t texelT0;                                                \
-				texelT0 = genTexture(&vd->tmu[0], x, dither4, TEXMODE0, vd->tmu[0].lookup, extra->lodbase0, \
+				texelT0 = genTexture(&vd->tmu[0], x, dither4, TEXMODE0, vd->tmu[0].lookup, extra.lodbase0, \
 																iters0, itert0, iterw0, lod0); \
 				texel = combineTexture(&vd->tmu[0], TEXMODE0, texelT0, texel, lod0); \
 			}                                                                   \
@@ -2796,19 +2794,19 @@ void voodoo_device::raster_##name(void *destbase, INT32 y, const poly_extent *ex
 																				\
 		/* update the iterated parameters */                                    \
 		iterargb += iterargbDelta;                                              \
-		iterz += extra->dzdx;                                                   \
-		iterw += extra->dwdx;                                                   \
+		iterz += extra.dzdx;                                                   \
+		iterw += extra.dwdx;                                                   \
 		if (TMUS >= 1)                                                          \
 		{                                                                       \
-			iterw0 += extra->dw0dx;                                             \
-			iters0 += extra->ds0dx;                                             \
-			itert0 += extra->dt0dx;                                             \
+			iterw0 += extra.dw0dx;                                             \
+			iters0 += extra.ds0dx;                                             \
+			itert0 += extra.dt0dx;                                             \
 		}                                                                       \
 		if (TMUS >= 2)                                                          \
 		{                                                                       \
-			iterw1 += extra->dw1dx;                                             \
-			iters1 += extra->ds1dx;                                             \
-			itert1 += extra->dt1dx;                                             \
+			iterw1 += extra.dw1dx;                                             \
+			iters1 += extra.ds1dx;                                             \
+			itert1 += extra.dt1dx;                                             \
 		}                                                                       \
 	}                                                                           \
 }
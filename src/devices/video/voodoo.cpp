@@ -162,7 +162,6 @@ bits(7:4) and bit(24)), X, and Y:
 #define LOG_FIFO            (0)
 #define LOG_FIFO_VERBOSE    (0)
 #define LOG_REGISTERS       (0)
-#define LOG_WAITS           (0)
 #define LOG_LFB             (0)
 #define LOG_TEXTURE_RAM     (0)
 #define LOG_RASTERIZERS     (0)
@@ -2407,21 +2406,21 @@ INT32 voodoo_device::register_w(voodoo_device *vd, offs_t offset, UINT32 data)
 
 		/* mask off invalid bits for different cards */
 		case fbzColorPath:
-			poly_wait(vd->poly, vd->regnames[regnum]);
+			vd->poly->wait(vd->regnames[regnum]);
 			if (vd->vd_type < TYPE_VOODOO_2)
 				data &= 0x0fffffff;
 			if (chips & 1) vd->reg[fbzColorPath].u = data;
 			break;
 
 		case fbzMode:
-			poly_wait(vd->poly, vd->regnames[regnum]);
+			vd->poly->wait(vd->regnames[regnum]);
 			if (vd->vd_type < TYPE_VOODOO_2)
 				data &= 0x001fffff;
 			if (chips & 1) vd->reg[fbzMode].u = data;
 			break;
 
 		case fogMode:
-			poly_wait(vd->poly, vd->regnames[regnum]);
+			vd->poly->wait(vd->regnames[regnum]);
 			if (vd->vd_type < TYPE_VOODOO_2)
 				data &= 0x0000003f;
 			if (chips & 1) vd->reg[fogMode].u = data;
@@ -2450,7 +2449,7 @@ INT32 voodoo_device::register_w(voodoo_device *vd, offs_t offset, UINT32 data)
 
 		/* other commands */
 		case nopCMD:
-			poly_wait(vd->poly, vd->regnames[regnum]);
+			vd->poly->wait(vd->regnames[regnum]);
 			if (data & 1)
 				reset_counters(vd);
 			if (data & 2)
@@ -2462,12 +2461,12 @@ INT32 voodoo_device::register_w(voodoo_device *vd, offs_t offset, UINT32 data)
 			break;
 
 		case swapbufferCMD:
-			poly_wait(vd->poly, vd->regnames[regnum]);
+			vd->poly->wait(vd->regnames[regnum]);
 			cycles = swapbuffer(vd, data);
 			break;
 
 		case userIntrCMD:
-			poly_wait(vd->poly, vd->regnames[regnum]);
+			vd->poly->wait(vd->regnames[regnum]);
 			//fatalerror("userIntrCMD\n");
 
 			vd->reg[intrCtrl].u |= 0x1800;
@@ -2482,7 +2481,7 @@ INT32 voodoo_device::register_w(voodoo_device *vd, offs_t offset, UINT32 data)
 		case clutData:
 			if (vd->vd_type <= TYPE_VOODOO_2 && (chips & 1))
 			{
-				poly_wait(vd->poly, vd->regnames[regnum]);
+				vd->poly->wait(vd->regnames[regnum]);
 				if (!FBIINIT1_VIDEO_TIMING_RESET(vd->reg[fbiInit1].u))
 				{
 					int index = data >> 24;
@@ -2501,7 +2500,7 @@ INT32 voodoo_device::register_w(voodoo_device *vd, offs_t offset, UINT32 data)
 		case dacData:
 			if (vd->vd_type <= TYPE_VOODOO_2 && (chips & 1))
 			{
-				poly_wait(vd->poly, vd->regnames[regnum]);
+				vd->poly->wait(vd->regnames[regnum]);
 				if (!(data & 0x800))
 					dacdata_w(&vd->dac, (data >> 8) & 7, data & 0xff);
 				else
@@ -2516,7 +2515,7 @@ INT32 voodoo_device::register_w(voodoo_device *vd, offs_t offset, UINT32 data)
 		case videoDimensions:
 			if (vd->vd_type <= TYPE_VOODOO_2 && (chips & 1))
 			{
-				poly_wait(vd->poly, vd->regnames[regnum]);
+				vd->poly->wait(vd->regnames[regnum]);
 				vd->reg[regnum].u = data;
 				if (vd->reg[hSync].u != 0 && vd->reg[vSync].u != 0 && vd->reg[videoDimensions].u != 0)
 				{
@@ -2605,7 +2604,7 @@ INT32 voodoo_device::register_w(voodoo_device *vd, offs_t offset, UINT32 data)
 
 		/* fbiInit0 can only be written if initEnable says we can -- Voodoo/Voodoo2 only */
 		case fbiInit0:
-			poly_wait(vd->poly, vd->regnames[regnum]);
+			vd->poly->wait(vd->regnames[regnum]);
 			if (vd->vd_type <= TYPE_VOODOO_2 && (chips & 1) && INITEN_ENABLE_HW_INIT(vd->pci.init_enable))
 			{
 				vd->reg[fbiInit0].u = data;
@@ -2629,7 +2628,7 @@ INT32 voodoo_device::register_w(voodoo_device *vd, offs_t offset, UINT32 data)
 		case fbiInit1:
 		case fbiInit2:
 		case fbiInit4:
-			poly_wait(vd->poly, vd->regnames[regnum]);
+			vd->poly->wait(vd->regnames[regnum]);
 			if (vd->vd_type <= TYPE_VOODOO_2 && (chips & 1) && INITEN_ENABLE_HW_INIT(vd->pci.init_enable))
 			{
 				vd->reg[regnum].u = data;
@@ -2639,7 +2638,7 @@ INT32 voodoo_device::register_w(voodoo_device *vd, offs_t offset, UINT32 data)
 			break;
 
 		case fbiInit3:
-			poly_wait(vd->poly, vd->regnames[regnum]);
+			vd->poly->wait(vd->regnames[regnum]);
 			if (vd->vd_type <= TYPE_VOODOO_2 && (chips & 1) && INITEN_ENABLE_HW_INIT(vd->pci.init_enable))
 			{
 				vd->reg[regnum].u = data;
@@ -2653,7 +2652,7 @@ INT32 voodoo_device::register_w(voodoo_device *vd, offs_t offset, UINT32 data)
 /*      case swapPending: -- Banshee */
 			if (vd->vd_type == TYPE_VOODOO_2 && (chips & 1) && INITEN_ENABLE_HW_INIT(vd->pci.init_enable))
 			{
-				poly_wait(vd->poly, vd->regnames[regnum]);
+				vd->poly->wait(vd->regnames[regnum]);
 				vd->reg[regnum].u = data;
 				vd->fbi.cmdfifo[0].enable = FBIINIT7_CMDFIFO_ENABLE(data);
 				vd->fbi.cmdfifo[0].count_holes = !FBIINIT7_DISABLE_CMDFIFO_HOLES(data);
@@ -2666,7 +2665,7 @@ INT32 voodoo_device::register_w(voodoo_device *vd, offs_t offset, UINT32 data)
 		case cmdFifoBaseAddr:
 			if (vd->vd_type == TYPE_VOODOO_2 && (chips & 1))
 			{
-				poly_wait(vd->poly, vd->regnames[regnum]);
+				vd->poly->wait(vd->regnames[regnum]);
 				vd->reg[regnum].u = data;
 				vd->fbi.cmdfifo[0].base = (data & 0x3ff) << 12;
 				vd->fbi.cmdfifo[0].end = (((data >> 16) & 0x3ff) + 1) << 12;
@@ -2742,7 +2741,7 @@ INT32 voodoo_device::register_w(voodoo_device *vd, offs_t offset, UINT32 data)
 		case nccTable+9:
 		case nccTable+10:
 		case nccTable+11:
-			poly_wait(vd->poly, vd->regnames[regnum]);
+			vd->poly->wait(vd->regnames[regnum]);
 			if (chips & 2) ncc_table_write(&vd->tmu[0].ncc[0], regnum - nccTable, data);
 			if (chips & 4) ncc_table_write(&vd->tmu[1].ncc[0], regnum - nccTable, data);
 			break;
@@ -2759,7 +2758,7 @@ INT32 voodoo_device::register_w(voodoo_device *vd, offs_t offset, UINT32 data)
 		case nccTable+21:
 		case nccTable+22:
 		case nccTable+23:
-			poly_wait(vd->poly, vd->regnames[regnum]);
+			vd->poly->wait(vd->regnames[regnum]);
 			if (chips & 2) ncc_table_write(&vd->tmu[0].ncc[1], regnum - (nccTable+12), data);
 			if (chips & 4) ncc_table_write(&vd->tmu[1].ncc[1], regnum - (nccTable+12), data);
 			break;
@@ -2797,7 +2796,7 @@ INT32 voodoo_device::register_w(voodoo_device *vd, offs_t offset, UINT32 data)
 		case fogTable+29:
 		case fogTable+30:
 		case fogTable+31:
-			poly_wait(vd->poly, vd->regnames[regnum]);
+			vd->poly->wait(vd->regnames[regnum]);
 			if (chips & 1)
 			{
 				int base = 2 * (regnum - fogTable);
@@ -2816,7 +2815,7 @@ INT32 voodoo_device::register_w(voodoo_device *vd, offs_t offset, UINT32 data)
 		case texBaseAddr_1:
 		case texBaseAddr_2:
 		case texBaseAddr_3_8:
-			poly_wait(vd->poly, vd->regnames[regnum]);
+			vd->poly->wait(vd->regnames[regnum]);
 			if (chips & 2)
 			{
 				vd->tmu[0].reg[regnum].u = data;
@@ -2845,7 +2844,7 @@ INT32 voodoo_device::register_w(voodoo_device *vd, offs_t offset, UINT32 data)
 		case color0:
 		case clipLowYHighY:
 		case clipLeftRight:
-			poly_wait(vd->poly, vd->regnames[regnum]);
+			vd->poly->wait(vd->regnames[regnum]);
 			/* fall through to default implementation */
 
 		/* by default, just feed the data to the chips */
@@ -3173,7 +3172,7 @@ INT32 voodoo_device::lfb_w(voodoo_device* vd, offs_t offset, UINT32 data, UINT32
 		COMPUTE_DITHER_POINTERS_NO_DITHER_VAR(vd->reg[fbzMode].u, y);
 
 		/* wait for any outstanding work to finish */
-		poly_wait(vd->poly, "LFB Write");
+		vd->poly->wait("LFB Write");
 
 		/* loop over up to two pixels */
 		for (pix = 0; mask; pix++)
@@ -3328,7 +3327,7 @@ INT32 voodoo_device::lfb_w(voodoo_device* vd, offs_t offset, UINT32 data, UINT32
 
 
 				/* wait for any outstanding work to finish */
-				poly_wait(vd->poly, "LFB Write");
+				vd->poly->wait("LFB Write");
 
 				/* pixel pipeline part 2 handles color blending, fog, alpha, and final output */
 				PIXEL_PIPELINE_END(vd, stats, dither, dither4, dither_lookup, x, dest, depth,
@@ -3369,7 +3368,7 @@ INT32 voodoo_device::texture_w(voodoo_device *vd, offs_t offset, UINT32 data)
 		fatalerror("Texture direct write!\n");
 
 	/* wait for any outstanding work to finish */
-	poly_wait(vd->poly, "Texture write");
+	vd->poly->wait("Texture write");
 
 	/* update texture info if dirty */
 	if (t->regdirty)
@@ -4026,7 +4025,7 @@ static UINT32 lfb_r(voodoo_device *vd, offs_t offset, bool lfb_3d)
 	}
 
 	/* wait for any outstanding work to finish */
-	poly_wait(vd->poly, "LFB read");
+	vd->poly->wait("LFB read");
 
 	/* compute the data */
 	data = buffer[bufoffs + 0] | (buffer[bufoffs + 1] << 16);
@@ -4944,7 +4943,7 @@ void voodoo_device::common_start_voodoo(UINT8 type)
 	device->m_stall.resolve();
 
 	/* create a multiprocessor work queue */
-	poly = poly_alloc(machine(), 64, sizeof(poly_extra_data), 0);
+	poly = auto_alloc(machine(), voodoo_poly_manager(machine()));
 	thread_stats = auto_alloc_array(machine(), stats_block, WORK_MAX_THREADS);
 
 	/* create a table of precomputed 1/n and log2(n) values */
@@ -5124,7 +5123,7 @@ INT32 voodoo_device::fastfill(voodoo_device *vd)
 	int ex = (vd->reg[clipLeftRight].u >> 0) & 0x3ff;
 	int sy = (vd->reg[clipLowYHighY].u >> 16) & 0x3ff;
 	int ey = (vd->reg[clipLowYHighY].u >> 0) & 0x3ff;
-	poly_extent extents[64];
+	voodoo_poly_manager::extent_t extents[64];
 	UINT16 dithermatrix[16];
 	UINT16 *drawbuf = nullptr;
 	UINT32 pixels = 0;
@@ -5179,13 +5178,13 @@ INT32 voodoo_device::fastfill(voodoo_device *vd)
 	/* iterate over blocks of extents */
 	for (y = sy; y < ey; y += ARRAY_LENGTH(extents))
 	{
-		poly_extra_data *extra = (poly_extra_data *)poly_get_extra_data(vd->poly);
+		poly_extra_data &extra = vd->poly->object_data_alloc();
 		int count = MIN(ey - y, ARRAY_LENGTH(extents));
 
-		extra->device= vd;
-		memcpy(extra->dither, dithermatrix, sizeof(extra->dither));
+		extra.destbase = drawbuf;
+		memcpy(extra.dither, dithermatrix, sizeof(extra.dither));
 
-		pixels += poly_render_triangle_custom(vd->poly, drawbuf, global_cliprect, raster_fastfill, y, count, extents);
+		pixels += vd->poly->render_triangle_custom(global_cliprect, voodoo_poly_manager::render_delegate(FUNC(raster_fastfill), vd), y, count, extents);
 	}
 
 	/* 2 pixels per clock */
@@ -5273,7 +5272,7 @@ INT32 voodoo_device::triangle(voodoo_device *vd)
 	}
 
 	/* wait for any outstanding work to finish */
-//  poly_wait(vd->poly, "triangle");
+//  vd->poly->wait("triangle");
 
 	/* determine the draw buffer */
 	destbuf = (vd->vd_type >= TYPE_VOODOO_BANSHEE) ? 1 : FBZMODE_DRAW_BUFFER(vd->reg[fbzMode].u);
@@ -5524,10 +5523,9 @@ INT32 voodoo_device::setup_and_draw_triangle(voodoo_device *vd)
 
 INT32 voodoo_device::triangle_create_work_item(voodoo_device* vd, UINT16 *drawbuf, int texcount)
 {
-	poly_extra_data *extra = (poly_extra_data *)poly_get_extra_data(vd->poly);
-
+	poly_extra_data &extra = vd->poly->object_data_alloc();
 	raster_info *info = find_rasterizer(vd, texcount);
-	poly_vertex vert[3];
+	voodoo_poly_manager::vertex_t vert[3];
 
 	/* fill in the vertex data */
 	vert[0].x = (float)vd->fbi.ax * (1.0f / 16.0f);
@@ -5538,66 +5536,66 @@ INT32 voodoo_device::triangle_create_work_item(voodoo_device* vd, UINT16 *drawbu
 	vert[2].y = (float)vd->fbi.cy * (1.0f / 16.0f);
 
 	/* fill in the extra data */
-	extra->device = vd;
-	extra->info = info;
+	extra.info = info;
+	extra.destbase = drawbuf;
 
 	/* fill in triangle parameters */
-	extra->ax = vd->fbi.ax;
-	extra->ay = vd->fbi.ay;
-	extra->startr = vd->fbi.startr;
-	extra->startg = vd->fbi.startg;
-	extra->startb = vd->fbi.startb;
-	extra->starta = vd->fbi.starta;
-	extra->startz = vd->fbi.startz;
-	extra->startw = vd->fbi.startw;
-	extra->drdx = vd->fbi.drdx;
-	extra->dgdx = vd->fbi.dgdx;
-	extra->dbdx = vd->fbi.dbdx;
-	extra->dadx = vd->fbi.dadx;
-	extra->dzdx = vd->fbi.dzdx;
-	extra->dwdx = vd->fbi.dwdx;
-	extra->drdy = vd->fbi.drdy;
-	extra->dgdy = vd->fbi.dgdy;
-	extra->dbdy = vd->fbi.dbdy;
-	extra->dady = vd->fbi.dady;
-	extra->dzdy = vd->fbi.dzdy;
-	extra->dwdy = vd->fbi.dwdy;
+	extra.ax = vd->fbi.ax;
+	extra.ay = vd->fbi.ay;
+	extra.startr = vd->fbi.startr;
+	extra.startg = vd->fbi.startg;
+	extra.startb = vd->fbi.startb;
+	extra.starta = vd->fbi.starta;
+	extra.startz = vd->fbi.startz;
+	extra.startw = vd->fbi.startw;
+	extra.drdx = vd->fbi.drdx;
+	extra.dgdx = vd->fbi.dgdx;
+	extra.dbdx = vd->fbi.dbdx;
+	extra.dadx = vd->fbi.dadx;
+	extra.dzdx = vd->fbi.dzdx;
+	extra.dwdx = vd->fbi.dwdx;
+	extra.drdy = vd->fbi.drdy;
+	extra.dgdy = vd->fbi.dgdy;
+	extra.dbdy = vd->fbi.dbdy;
+	extra.dady = vd->fbi.dady;
+	extra.dzdy = vd->fbi.dzdy;
+	extra.dwdy = vd->fbi.dwdy;
 
 	/* fill in texture 0 parameters */
 	if (texcount > 0)
 	{
-		extra->starts0 = vd->tmu[0].starts;
-		extra->startt0 = vd->tmu[0].startt;
-		extra->startw0 = vd->tmu[0].startw;
-		extra->ds0dx = vd->tmu[0].dsdx;
-		extra->dt0dx = vd->tmu[0].dtdx;
-		extra->dw0dx = vd->tmu[0].dwdx;
-		extra->ds0dy = vd->tmu[0].dsdy;
-		extra->dt0dy = vd->tmu[0].dtdy;
-		extra->dw0dy = vd->tmu[0].dwdy;
-		extra->lodbase0 = prepare_tmu(&vd->tmu[0]);
+		extra.starts0 = vd->tmu[0].starts;
+		extra.startt0 = vd->tmu[0].startt;
+		extra.startw0 = vd->tmu[0].startw;
+		extra.ds0dx = vd->tmu[0].dsdx;
+		extra.dt0dx = vd->tmu[0].dtdx;
+		extra.dw0dx = vd->tmu[0].dwdx;
+		extra.ds0dy = vd->tmu[0].dsdy;
+		extra.dt0dy = vd->tmu[0].dtdy;
+		extra.dw0dy = vd->tmu[0].dwdy;
+		extra.lodbase0 = prepare_tmu(&vd->tmu[0]);
 		vd->stats.texture_mode[TEXMODE_FORMAT(vd->tmu[0].reg[textureMode].u)]++;
 
 		/* fill in texture 1 parameters */
 		if (texcount > 1)
 		{
-			extra->starts1 = vd->tmu[1].starts;
-			extra->startt1 = vd->tmu[1].startt;
-			extra->startw1 = vd->tmu[1].startw;
-			extra->ds1dx = vd->tmu[1].dsdx;
-			extra->dt1dx = vd->tmu[1].dtdx;
-			extra->dw1dx = vd->tmu[1].dwdx;
-			extra->ds1dy = vd->tmu[1].dsdy;
-			extra->dt1dy = vd->tmu[1].dtdy;
-			extra->dw1dy = vd->tmu[1].dwdy;
-			extra->lodbase1 = prepare_tmu(&vd->tmu[1]);
+			extra.starts1 = vd->tmu[1].starts;
+			extra.startt1 = vd->tmu[1].startt;
+			extra.startw1 = vd->tmu[1].startw;
+			extra.ds1dx = vd->tmu[1].dsdx;
+			extra.dt1dx = vd->tmu[1].dtdx;
+			extra.dw1dx = vd->tmu[1].dwdx;
+			extra.ds1dy = vd->tmu[1].dsdy;
+			extra.dt1dy = vd->tmu[1].dtdy;
+			extra.dw1dy = vd->tmu[1].dwdy;
+			extra.lodbase1 = prepare_tmu(&vd->tmu[1]);
 			vd->stats.texture_mode[TEXMODE_FORMAT(vd->tmu[1].reg[textureMode].u)]++;
 		}
 	}
 
 	/* farm the rasterization out to other threads */
 	info->polys++;
-	return poly_render_triangle(vd->poly, drawbuf, global_cliprect, info->callback, 0, &vert[0], &vert[1], &vert[2]);
+	return vd->poly->render_triangle(global_cliprect, voodoo_poly_manager::render_delegate(info->callback, "voodoo_device::raster", vd), 0, vert[0], vert[1], vert[2]);
 }
 
 
@@ -5787,7 +5785,15 @@ void voodoo_device::device_stop()
 {
 	/* release the work queue, ensuring all work is finished */
 	if (poly != nullptr)
-		poly_free(poly);
+	{
+		poly->wait("device_stop");
+
+		/* dump the final rasterizer usage for voodoo_rast.hxx */
+		if (LOG_RASTERIZERS)
+			dump_rasterizer_stats(this);
+		auto_free(machine(), poly);
+		poly = nullptr;
+	}
 }
 
 
@@ -5874,13 +5880,11 @@ void voodoo_3_device::device_start()
     implementation of the 'fastfill' command
 -------------------------------------------------*/
 
-void voodoo_device::raster_fastfill(void *destbase, INT32 y, const poly_extent *extent, const void *extradata, int threadid)
+void voodoo_device::raster_fastfill(voodoo_device *vd, INT32 y, const voodoo_poly_manager::extent_t &extent, const poly_extra_data &extra, int threadid)
 {
-	const poly_extra_data *extra = (const poly_extra_data *)extradata;
-	voodoo_device* vd = extra->device;
 	stats_block *stats = &vd->thread_stats[threadid];
-	INT32 startx = extent->startx;
-	INT32 stopx = extent->stopx;
+	INT32 startx = extent.startx;
+	INT32 stopx = extent.stopx;
 	int scry, x;
 
 	/* determine the screen Y */
@@ -5891,9 +5895,9 @@ void voodoo_device::raster_fastfill(void *destbase, INT32 y, const poly_extent *
 	/* fill this RGB row */
 	if (FBZMODE_RGB_BUFFER_MASK(vd->reg[fbzMode].u))
 	{
-		const UINT16 *ditherow = &extra->dither[(y & 3) * 4];
+		const UINT16 *ditherow = &extra.dither[(y & 3) * 4];
 		UINT64 expanded = *(UINT64 *)ditherow;
-		UINT16 *dest = (UINT16 *)destbase + scry * vd->fbi.rowpixels;
+		UINT16 *dest = extra.destbase + scry * vd->fbi.rowpixels;
 
 		for (x = startx; x < stopx && (x & 3) != 0; x++)
 			dest[x] = ditherow[x & 3];
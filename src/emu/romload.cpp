@@ -542,35 +542,21 @@ void rom_load_manager::region_post_process(const char *rgntag, bool invert)
 
 
 /*-------------------------------------------------
-    open_rom_file - open a ROM file, searching
-    up the parent and loading by checksum
+    rom_search_locations - build the ordered list
+    of locations to search for a ROM file
 -------------------------------------------------*/
 
-int rom_load_manager::open_rom_file(const char *regiontag, const rom_entry *romp, std::string &tried_file_names, bool from_list)
+std::vector<std::string> rom_load_manager::rom_search_locations(const char *regiontag)
 {
-	osd_file::error filerr = osd_file::error::NOT_FOUND;
-	UINT32 romsize = rom_file_size(romp);
-	tried_file_names = "";
-
-	/* update status display */
-	display_loading_rom_message(ROM_GETNAME(romp), from_list);
-
-	/* extract CRC to use for searching */
-	UINT32 crc = 0;
-	bool has_crc = hash_collection(ROM_GETHASHDATA(romp)).crc(crc);
+	std::vector<std::string> locations;
 
 	/* attempt reading up the chain through the parents. It automatically also
 	 attempts any kind of load by checksum supported by the archives. */
-	m_file = nullptr;
-	for (int drv = driver_list::find(machine().system()); m_file == nullptr && drv != -1; drv = driver_list::clone(drv)) {
-		if (tried_file_names.length() != 0)
-			tried_file_names += " ";
-		tried_file_names += driver_list::driver(drv).name;
-		m_file = common_process_file(machine().options(), driver_list::driver(drv).name, has_crc, crc, romp, filerr);
-	}
+	for (int drv = driver_list::find(machine().system()); drv != -1; drv = driver_list::clone(drv))
+		locations.push_back(driver_list::driver(drv).name);
 
 	/* if the region is load by name, load the ROM from there */
-	if (m_file == nullptr && regiontag != nullptr)
+	if (regiontag != nullptr)
 	{
 		// check if we are dealing with softwarelists. if so, locationtag
 		// is actually a concatenation of: listname + setname + parentname
@@ -617,39 +603,84 @@ int rom_load_manager::open_rom_file(const char *regiontag, const rom_entry *romp
 		// - if we are not using lists, we have regiontag only;
 		// - if we are using lists, we have: list/clonename, list/parentname, clonename, parentname
 		if (!is_list)
-		{
-			tried_file_names += " " + tag1;
-			m_file = common_process_file(machine().options(), tag1.c_str(), has_crc, crc, romp, filerr);
-		}
+			locations.push_back(tag1);
 		else
 		{
-			// try to load from list/setname
-			if ((m_file == nullptr) && (tag2.c_str() != nullptr))
-			{
-				tried_file_names += " " + tag2;
-				m_file = common_process_file(machine().options(), tag2.c_str(), has_crc, crc, romp, filerr);
-			}
-			// try to load from list/parentname
-			if ((m_file == nullptr) && has_parent && (tag3.c_str() != nullptr))
-			{
-				tried_file_names += " " + tag3;
-				m_file = common_process_file(machine().options(), tag3.c_str(), has_crc, crc, romp, filerr);
-			}
-			// try to load from setname
-			if ((m_file == nullptr) && (tag4.c_str() != nullptr))
-			{
-				tried_file_names += " " + tag4;
-				m_file = common_process_file(machine().options(), tag4.c_str(), has_crc, crc, romp, filerr);
-			}
-			// try to load from parentname
-			if ((m_file == nullptr) && has_parent && (tag5.c_str() != nullptr))
-			{
-				tried_file_names += " " + tag5;
-				m_file = common_process_file(machine().options(), tag5.c_str(), has_crc, crc, romp, filerr);
-			}
+			locations.push_back(tag2);
+			if (has_parent)
+				locations.push_back(tag3);
+			locations.push_back(tag4);
+			if (has_parent)
+				locations.push_back(tag5);
 		}
 	}
 
+	return locations;
+}
+
+
+/*-------------------------------------------------
+    search_rom_file - try each location in turn
+    until the ROM file is found; safe to call from
+    a worker thread
+-------------------------------------------------*/
+
+std::unique_ptr<emu_file> rom_load_manager::search_rom_file(emu_options &options, const std::vector<std::string> &locations, const rom_entry *romp, osd_file::error &filerr)
+{
+	/* extract CRC to use for searching */
+	UINT32 crc = 0;
+	bool has_crc = hash_collection(ROM_GETHASHDATA(romp)).crc(crc);
+
+	std::unique_ptr<emu_file> file;
+	filerr = osd_file::error::NOT_FOUND;
+	for (auto it = locations.begin(); file == nullptr && it != locations.end(); ++it)
+		file = common_process_file(options, it->c_str(), has_crc, crc, romp, filerr);
+	return file;
+}
+
+
+/*-------------------------------------------------
+    open_rom_file - open a ROM file, searching
+    up the parent and loading by checksum
+-------------------------------------------------*/
+
+int rom_load_manager::open_rom_file(const char *regiontag, const rom_entry *romp, device_t *device, std::string &tried_file_names, bool from_list)
+{
+	osd_file::error filerr = osd_file::error::NOT_FOUND;
+	UINT32 romsize = rom_file_size(romp);
+	tried_file_names = "";
+
+	/* update status display */
+	display_loading_rom_message(ROM_GETNAME(romp), from_list);
+
+	/* if the file was prefetched, wait for the worker and take over its result */
+	std::vector<std::string> locations;
+	auto prefetched = m_prefetch.find(std::make_pair(device, romp));
+	if (prefetched != m_prefetch.end())
+	{
+		prefetch_file &entry = *prefetched->second;
+		finish_prefetch(entry);
+		locations = std::move(entry.m_locations);
+		m_file = std::move(entry.m_file);
+		filerr = entry.m_filerr;
+		m_prefetch.erase(prefetched);
+	}
+
+	/* otherwise search for it now */
+	else
+	{
+		locations = rom_search_locations(regiontag);
+		m_file = search_rom_file(machine().options(), locations, romp, filerr);
+	}
+
+	/* report every location that was searched */
+	for (const std::string &location : locations)
+	{
+		if (tried_file_names.length() != 0)
+			tried_file_names += " ";
+		tried_file_names += location;
+	}
+
 	/* update counters */
 	m_romsloaded++;
 	m_romsloadedsize += romsize;
@@ -659,6 +690,104 @@ int rom_load_manager::open_rom_file(const char *regiontag, const rom_entry *romp
 }
 
 
+/*-------------------------------------------------
+    prefetch_rom_file - worker callback that opens,
+    decompresses and hashes a single ROM file
+-------------------------------------------------*/
+
+void *rom_load_manager::prefetch_rom_file(void *param, int threadid)
+{
+	prefetch_file &entry = *reinterpret_cast<prefetch_file *>(param);
+
+	entry.m_file = search_rom_file(*entry.m_options, entry.m_locations, entry.m_romp, entry.m_filerr);
+
+	/* compute the hashes now so verification doesn't need to touch the data again */
+	if (entry.m_file != nullptr)
+		entry.m_file->hashes(hash_collection(ROM_GETHASHDATA(entry.m_romp)).hash_types().c_str());
+	return nullptr;
+}
+
+
+/*-------------------------------------------------
+    finish_prefetch - wait for a prefetched file's
+    worker to complete and release its work item
+-------------------------------------------------*/
+
+void rom_load_manager::finish_prefetch(prefetch_file &entry)
+{
+	if (entry.m_item != nullptr)
+	{
+		while (!osd_work_item_wait(entry.m_item, osd_ticks_per_second()))
+			;
+		osd_work_item_release(entry.m_item);
+		entry.m_item = nullptr;
+	}
+}
+
+
+/*-------------------------------------------------
+    release_prefetch - wait for any outstanding
+    prefetches and free the work queue
+-------------------------------------------------*/
+
+void rom_load_manager::release_prefetch()
+{
+	for (auto &entry : m_prefetch)
+		finish_prefetch(*entry.second);
+	m_prefetch.clear();
+
+	if (m_prefetch_queue != nullptr)
+	{
+		osd_work_queue_free(m_prefetch_queue);
+		m_prefetch_queue = nullptr;
+	}
+}
+
+
+/*-------------------------------------------------
+    prefetch_rom_files - queue every ROM file the
+    machine needs to be opened and hashed on the
+    work queue; the results are consumed in order
+    by process_rom_entries
+-------------------------------------------------*/
+
+void rom_load_manager::prefetch_rom_files()
+{
+	m_prefetch_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO | WORK_QUEUE_FLAG_MULTI);
+	if (m_prefetch_queue == nullptr)
+		return;
+
+	for (device_t &device : device_iterator(machine().root_device()))
+		for (const rom_entry *region = rom_first_region(device); region != nullptr; region = rom_next_region(region))
+		{
+			if (!ROMREGION_ISROMDATA(region))
+				continue;
+
+			for (const rom_entry *rom = rom_first_file(region); rom != nullptr; rom = rom_next_file(rom))
+				if (ROM_GETBIOSFLAGS(rom) == 0 || ROM_GETBIOSFLAGS(rom) == device.system_bios())
+				{
+					/* ROM tables are shared between instances of a device type, so key by both */
+					auto key = std::make_pair(const_cast<const device_t *>(&device), rom);
+					if (m_prefetch.find(key) != m_prefetch.end())
+						continue;
+
+					/* search the same locations process_region_list hands to open_rom_file */
+					std::unique_ptr<prefetch_file> &entry = m_prefetch[key];
+					entry = std::make_unique<prefetch_file>();
+					entry->m_options = &machine().options();
+					entry->m_romp = rom;
+					entry->m_locations = rom_search_locations(device.shortname());
+					entry->m_filerr = osd_file::error::NOT_FOUND;
+					entry->m_item = osd_work_item_queue(m_prefetch_queue, prefetch_rom_file, entry.get(), 0);
+
+					/* if it couldn't be queued, it will be opened synchronously */
+					if (entry->m_item == nullptr)
+						m_prefetch.erase(key);
+				}
+		}
+}
+
+
 /*-------------------------------------------------
     rom_fread - cheesy fread that fills with
     random data for a nullptr file
@@ -891,7 +1020,7 @@ void rom_load_manager::process_rom_entries(const char *regiontag, const rom_entr
 			/* open the file if it is a non-BIOS or matches the current BIOS */
 			LOG(("Opening ROM file: %s\n", ROM_GETNAME(romp)));
 			std::string tried_file_names;
-			if (!irrelevantbios && !open_rom_file(regiontag, romp, tried_file_names, from_list))
+			if (!irrelevantbios && !open_rom_file(regiontag, romp, device, tried_file_names, from_list))
 				handle_missing_file(romp, tried_file_names, CHDERR_NONE);
 
 			/* loop until we run out of reloads */
@@ -1376,6 +1505,9 @@ void rom_load_manager::process_region_list()
 {
 	std::string regiontag;
 
+	/* start opening and hashing files in the background */
+	prefetch_rom_files();
+
 	/* loop until we hit the end */
 	device_iterator deviter(machine().root_device());
 	for (device_t &device : deviter)
@@ -1422,6 +1554,9 @@ void rom_load_manager::process_region_list()
 				process_disk_entries(regiontag.c_str(), region, region + 1, nullptr);
 		}
 
+	/* everything has been consumed, so release the workers */
+	release_prefetch();
+
 	/* now go back and post-process all the regions */
 	for (device_t &device : deviter)
 		for (const rom_entry *region = rom_first_region(device); region != nullptr; region = rom_next_region(region))
@@ -1447,6 +1582,7 @@ void rom_load_manager::process_region_list()
 
 rom_load_manager::rom_load_manager(running_machine &machine)
 	: m_machine(machine)
+	, m_prefetch_queue(nullptr)
 {
 	/* figure out which BIOS we are using */
 
@@ -1479,3 +1615,14 @@ rom_load_manager::rom_load_manager(running_machine &machine)
 	/* display the results and exit */
 	display_rom_load_results(FALSE);
 }
+
+
+/*-------------------------------------------------
+    ~rom_load_manager - make sure no workers are
+    still writing into our prefetch list
+-------------------------------------------------*/
+
+rom_load_manager::~rom_load_manager()
+{
+	release_prefetch();
+}
@@ -18,6 +18,8 @@
 
 #include "chd.h"
 
+#include <map>
+
 /***************************************************************************
     CONSTANTS
 ***************************************************************************/
@@ -279,9 +281,21 @@ class rom_load_manager
 		chd_file            m_diffchd;              /* handle to the diff CHD */
 	};
 
+	// a ROM file opened and hashed ahead of time on a worker thread
+	struct prefetch_file
+	{
+		emu_options *               m_options;              /* options to search with */
+		const rom_entry *           m_romp;                 /* ROM entry being searched for */
+		std::vector<std::string>    m_locations;            /* locations to search, in order */
+		std::unique_ptr<emu_file>   m_file;                 /* resulting file, or nullptr */
+		osd_file::error             m_filerr;               /* result of the final open attempt */
+		osd_work_item *             m_item;                 /* work item, or nullptr when done */
+	};
+
 public:
 	// construction/destruction
 	rom_load_manager(running_machine &machine);
+	~rom_load_manager();
 
 	// getters
 	running_machine &machine() const { return m_machine; }
@@ -314,7 +328,13 @@ private:
 	void display_loading_rom_message(const char *name, bool from_list);
 	void display_rom_load_results(bool from_list);
 	void region_post_process(const char *rgntag, bool invert);
-	int open_rom_file(const char *regiontag, const rom_entry *romp, std::string &tried_file_names, bool from_list);
+	std::vector<std::string> rom_search_locations(const char *regiontag);
+	int open_rom_file(const char *regiontag, const rom_entry *romp, device_t *device, std::string &tried_file_names, bool from_list);
+	void prefetch_rom_files();
+	void finish_prefetch(prefetch_file &entry);
+	void release_prefetch();
+	static void *prefetch_rom_file(void *param, int threadid);
+	static std::unique_ptr<emu_file> search_rom_file(emu_options &options, const std::vector<std::string> &locations, const rom_entry *romp, osd_file::error &filerr);
 	int rom_fread(UINT8 *buffer, int length, const rom_entry *parent_region);
 	int read_rom_data(const rom_entry *parent_region, const rom_entry *romp);
 	void fill_rom_data(const rom_entry *romp);
@@ -339,6 +359,8 @@ private:
 	UINT32          m_romstotalsize;      /* total size of ROMs to read */
 
 	std::unique_ptr<emu_file>  m_file;               /* current file */
+	osd_work_queue *           m_prefetch_queue;     /* queue for opening and hashing files ahead of time */
+	std::map<std::pair<const device_t *, const rom_entry *>, std::unique_ptr<prefetch_file>> m_prefetch;   /* files being prefetched, by device and ROM */
 	std::vector<std::unique_ptr<open_chd>> m_chd_list;     /* disks */
 
 	memory_region * m_region;             /* info about current region */
@@ -64,7 +64,10 @@ sound_stream::sound_stream(device_t &device, int inputs, int outputs, int sample
 		m_output_sampindex(0),
 		m_output_update_sampindex(0),
 		m_output_base_sampindex(0),
-		m_callback(std::move(callback))
+		m_idle(false),
+		m_idle_sampindex(0),
+		m_callback(std::move(callback)),
+		m_in_callback(false)
 {
 	// get the device's sound interface
 	device_sound_interface *sound;
@@ -320,6 +323,31 @@ const stream_sample_t *sound_stream::output_since_last_update(int outputnum, int
 }
 
 
+//-------------------------------------------------
+//  set_idle - mark the stream output as silent
+//  (or not); while idle the callback is not run
+//  and consumers skip resampling the silence
+//-------------------------------------------------
+
+void sound_stream::set_idle(bool idle)
+{
+	if (idle == m_idle)
+		return;
+
+	// from within the callback the state applies once the current batch is done;
+	// otherwise bring the output up to date with the old state first
+	if (m_in_callback)
+	{
+		m_idle = idle;
+		return;
+	}
+
+	update();
+	m_idle = idle;
+	m_idle_sampindex = m_output_sampindex;
+}
+
+
 //-------------------------------------------------
 //  set_sample_rate - set the sample rate on a
 //  given stream
@@ -389,6 +417,7 @@ void sound_stream::update_with_accounting(bool second_tick)
 	{
 		m_output_sampindex -= m_sample_rate;
 		m_output_base_sampindex -= m_sample_rate;
+		m_idle_sampindex = std::max(m_idle_sampindex - INT32(m_sample_rate), m_output_base_sampindex);
 	}
 
 	// note our current output sample
@@ -442,6 +471,7 @@ void sound_stream::apply_sample_rate_changes()
 	// clear out the buffer
 	for (auto & elem : m_output)
 		memset(&elem.m_buffer[0], 0, m_max_samples_per_update * sizeof(elem.m_buffer[0]));
+	m_idle_sampindex = m_output_base_sampindex;
 }
 
 
@@ -586,6 +616,10 @@ void sound_stream::postload()
 	m_output_sampindex = m_device.machine().sound().last_update().attoseconds() / m_attoseconds_per_sample;
 	m_output_update_sampindex = m_output_sampindex;
 	m_output_base_sampindex = m_output_sampindex - m_max_samples_per_update;
+
+	// the device reports its idle state again from its next update
+	m_idle = false;
+	m_idle_sampindex = m_output_base_sampindex;
 }
 
 
@@ -606,6 +640,14 @@ void sound_stream::generate_samples(int samples)
 
 	VPRINTF(("generate_samples(%p, %d)\n", (void *) this, samples));
 
+	// idle streams just produce silence, without touching their inputs
+	if (m_idle)
+	{
+		for (auto & output : m_output)
+			memset(&output.m_buffer[m_output_sampindex - m_output_base_sampindex], 0, samples * sizeof(output.m_buffer[0]));
+		return;
+	}
+
 	// ensure all inputs are up to date and generate resampled data
 	for (unsigned int inputnum = 0; inputnum < m_input.size(); inputnum++)
 	{
@@ -637,8 +679,14 @@ void sound_stream::generate_samples(int samples)
 
 	// run the callback
 	VPRINTF(("  callback(%p, %d)\n", (void *)this, samples));
+	m_in_callback = true;
 	m_callback(*this, inputs, outputs, samples);
+	m_in_callback = false;
 	VPRINTF(("  callback done\n"));
+
+	// if the callback went idle, its output is silent from the end of this batch on
+	if (m_idle)
+		m_idle_sampindex = m_output_sampindex + samples;
 }
 
 
@@ -673,6 +721,13 @@ stream_sample_t *sound_stream::generate_resampled_data(stream_input &input, UINT
 	else
 		basesample = -(-basetime / input_stream.m_attoseconds_per_sample) - 1;
 
+	// if the source has been silent since before the first sample, there's nothing to resample
+	if (input_stream.m_idle && basesample >= input_stream.m_idle_sampindex)
+	{
+		memset(dest, 0, numsamples * sizeof(*dest));
+		return &input.m_resample[0];
+	}
+
 	// compute a source pointer to the first sample
 	assert(basesample >= input_stream.m_output_base_sampindex);
 	stream_sample_t *source = &output.m_buffer[basesample - input_stream.m_output_base_sampindex];
@@ -112,11 +112,13 @@ public:
 	float user_gain(int inputnum) const;
 	float input_gain(int inputnum) const;
 	float output_gain(int outputnum) const;
+	bool idle() const { return m_idle; }
 
 	// operations
 	void set_input(int inputnum, sound_stream *input_stream, int outputnum = 0, float gain = 1.0f);
 	void update();
 	const stream_sample_t *output_since_last_update(int outputnum, int &numsamples);
+	void set_idle(bool idle);
 
 	// timing
 	void set_sample_rate(int sample_rate);
@@ -169,8 +171,13 @@ private:
 	INT32               m_output_update_sampindex;    // position at time of last global update
 	INT32               m_output_base_sampindex;      // sample at base of buffer, relative to the current emulated second
 
+	// idle information
+	bool                m_idle;                       // stream output is silent and the callback is skipped
+	INT32               m_idle_sampindex;             // first silent sample while idle, relative to the current emulated second
+
 	// callback information
 	stream_update_delegate  m_callback;                   // callback function
+	bool                m_in_callback;                // true while the callback is running
 };
 
 
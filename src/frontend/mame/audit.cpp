@@ -16,6 +16,10 @@
 #include "sound/samples.h"
 #include "softlist.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+
 //**************************************************************************
 //  CORE FUNCTIONS
 //**************************************************************************
@@ -24,10 +28,11 @@
 //  media_auditor - constructor
 //-------------------------------------------------
 
-media_auditor::media_auditor(const driver_enumerator &enumerator)
+media_auditor::media_auditor(const driver_enumerator &enumerator, audit_file_cache *cache)
 	: m_enumerator(enumerator),
 		m_validation(AUDIT_VALIDATE_FULL),
-		m_searchpath(nullptr)
+		m_searchpath(nullptr),
+		m_cache(cache)
 {
 }
 
@@ -424,23 +429,15 @@ audit_record *media_auditor::audit_one_rom(const rom_entry *rom)
 	bool has_crc = record.expected_hashes().crc(crc);
 
 	// find the file and checksum it, getting the file length along the way
-	emu_file file(m_enumerator.options().media_path(), OPEN_FLAG_READ | OPEN_FLAG_NO_PRELOAD);
-	file.set_restrict_to_mediapath(true);
 	path_iterator path(m_searchpath);
 	std::string curpath;
 	while (path.next(curpath, record.name()))
 	{
-		// open the file if we can
-		osd_file::error filerr;
-		if (has_crc)
-			filerr = file.open(curpath.c_str(), crc);
-		else
-			filerr = file.open(curpath.c_str());
-
 		// if it worked, get the actual length and hashes, then stop
-		if (filerr == osd_file::error::NONE)
+		audit_file_cache::entry result;
+		if (find_one_rom(curpath.c_str(), has_crc, crc, result))
 		{
-			record.set_actual(file.hashes(m_validation), file.size());
+			record.set_actual(result.hashes, result.length);
 			break;
 		}
 	}
@@ -451,6 +448,44 @@ audit_record *media_auditor::audit_one_rom(const rom_entry *rom)
 }
 
 
+//-------------------------------------------------
+//  find_one_rom - look for a ROM at a single
+//  location, consulting the shared cache first
+//-------------------------------------------------
+
+bool media_auditor::find_one_rom(const char *path, bool has_crc, UINT32 crc, audit_file_cache::entry &result)
+{
+	// the same location, CRC and hash types always give the same answer
+	std::string key;
+	if (m_cache != nullptr)
+	{
+		key = string_format("%s|%c%08x|%s", path, has_crc ? 'C' : '-', crc, m_validation);
+		if (m_cache->find(key, result))
+			return result.found;
+	}
+
+	// open the file if we can
+	emu_file file(m_enumerator.options().media_path(), OPEN_FLAG_READ | OPEN_FLAG_NO_PRELOAD);
+	file.set_restrict_to_mediapath(true);
+	osd_file::error filerr;
+	if (has_crc)
+		filerr = file.open(path, crc);
+	else
+		filerr = file.open(path);
+
+	result.found = (filerr == osd_file::error::NONE);
+	result.length = result.found ? file.size() : 0;
+	if (result.found)
+		result.hashes = file.hashes(m_validation);
+	else
+		result.hashes.reset();
+
+	if (m_cache != nullptr)
+		m_cache->add(key, result);
+	return result.found;
+}
+
+
 //-------------------------------------------------
 //  audit_one_disk - validate a single disk entry
 //-------------------------------------------------
@@ -603,3 +638,194 @@ audit_record::audit_record(const char *name, media_type type)
 		m_shared_device(nullptr)
 {
 }
+
+
+//-------------------------------------------------
+//  audit_file_cache - find a previous result
+//-------------------------------------------------
+
+bool audit_file_cache::find(const std::string &key, entry &result) const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	auto const found = m_entries.find(key);
+	if (found == m_entries.end())
+		return false;
+	result = found->second;
+	return true;
+}
+
+
+//-------------------------------------------------
+//  audit_file_cache - remember a result
+//-------------------------------------------------
+
+void audit_file_cache::add(const std::string &key, const entry &result)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_entries.emplace(key, result);
+}
+
+
+//**************************************************************************
+//  PARALLEL AUDITING
+//**************************************************************************
+
+namespace {
+
+// state shared between the workers of a parallel audit
+struct parallel_audit
+{
+	struct result
+	{
+		bool                        done;
+		media_auditor::summary      summary;
+		std::string                 details;
+		std::exception_ptr          error;          // rethrown on the calling thread
+	};
+
+	parallel_audit(emu_options &options, const char *validation)
+		: m_options(options),
+			m_validation(validation),
+			m_next(0)
+	{
+	}
+
+	emu_options &               m_options;
+	const char *                m_validation;
+	audit_file_cache            m_cache;
+	std::vector<int>            m_drivers;      // driver indices in output order
+	std::vector<result>         m_results;      // one per driver
+	std::atomic<std::size_t>    m_next;         // next driver to hand out
+	std::mutex                  m_mutex;
+	std::condition_variable     m_done;
+	std::mutex                  m_config_mutex; // held while building or freeing machine configs
+};
+
+
+//-------------------------------------------------
+//  prepare_configs - build the machine configs an
+//  audit of the driver will look at (its own and
+//  its parents'); configs are only ever built or
+//  freed one at a time, since that runs every
+//  device's constructor and config_complete(),
+//  which are not known to be free of static or
+//  lazily initialised state, so only the file I/O
+//  of the audit itself runs in parallel
+//-------------------------------------------------
+
+void prepare_configs(parallel_audit &audit, driver_enumerator &enumerator, int drvindex)
+{
+	std::lock_guard<std::mutex> lock(audit.m_config_mutex);
+	enumerator.config(drvindex);
+	for (int parent = enumerator.find(enumerator.driver(drvindex).parent); parent != -1; parent = enumerator.find(enumerator.driver(parent).parent))
+		enumerator.config(parent);
+}
+
+
+//-------------------------------------------------
+//  parallel_audit_worker - audit drivers until
+//  there are none left; each worker needs its own
+//  enumerator since they cache machine configs
+//-------------------------------------------------
+
+void *parallel_audit_worker(void *param, int threadid)
+{
+	parallel_audit &audit = *reinterpret_cast<parallel_audit *>(param);
+	auto enumerator = std::make_unique<driver_enumerator>(audit.m_options);
+	{
+		media_auditor auditor(*enumerator, &audit.m_cache);
+		for (std::size_t index = audit.m_next++; index < audit.m_drivers.size(); index = audit.m_next++)
+		{
+			media_auditor::summary summary = media_auditor::NOTFOUND;
+			std::string details;
+			std::exception_ptr error;
+			try
+			{
+				prepare_configs(audit, *enumerator, audit.m_drivers[index]);
+				enumerator->set_current(audit.m_drivers[index]);
+				summary = auditor.audit_media(audit.m_validation);
+				if (summary != media_auditor::NOTFOUND)
+					auditor.summarize(enumerator->driver().name, &details);
+			}
+			catch (...)
+			{
+				error = std::current_exception();
+			}
+
+			std::lock_guard<std::mutex> lock(audit.m_mutex);
+			parallel_audit::result &result = audit.m_results[index];
+			result.summary = summary;
+			result.details = std::move(details);
+			result.error = error;
+			result.done = true;
+			audit.m_done.notify_all();
+		}
+	}
+
+	// the cached configs are freed one worker at a time as well
+	std::lock_guard<std::mutex> lock(audit.m_config_mutex);
+	enumerator.reset();
+	return nullptr;
+}
+
+} // anonymous namespace
+
+
+//-------------------------------------------------
+//  audit_media_parallel - audit every included
+//  driver on a work queue, reporting in order
+//-------------------------------------------------
+
+void media_auditor::audit_media_parallel(const driver_enumerator &enumerator, const char *validation, audit_callback callback)
+{
+	parallel_audit audit(enumerator.options(), validation);
+	for (int drvindex = 0; drvindex < driver_list::total(); drvindex++)
+		if (enumerator.included(drvindex))
+			audit.m_drivers.push_back(drvindex);
+	audit.m_results.resize(audit.m_drivers.size(), parallel_audit::result{ false, NOTFOUND, std::string(), nullptr });
+
+	// without a work queue, audit one driver at a time on this thread
+	osd_work_queue *queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO | WORK_QUEUE_FLAG_MULTI);
+	if (queue == nullptr)
+	{
+		driver_enumerator serial(enumerator.options());
+		media_auditor auditor(serial, &audit.m_cache);
+		for (int drvindex : audit.m_drivers)
+		{
+			serial.set_current(drvindex);
+			summary const result = auditor.audit_media(validation);
+			std::string details;
+			if (result != NOTFOUND)
+				auditor.summarize(serial.driver().name, &details);
+			callback(drvindex, result, details);
+		}
+		return;
+	}
+
+	// start one worker per queue thread; they pull drivers from a shared counter
+	int const workers = (std::max)(1, osd_work_queue_threads(queue));
+	osd_work_item_queue_multiple(queue, parallel_audit_worker, workers, &audit, 0, WORK_ITEM_FLAG_AUTO_RELEASE);
+
+	// hand back results in driver order as they become available
+	for (std::size_t index = 0; index < audit.m_drivers.size(); index++)
+	{
+		parallel_audit::result result;
+		{
+			std::unique_lock<std::mutex> lock(audit.m_mutex);
+			audit.m_done.wait(lock, [&audit, index] { return audit.m_results[index].done; });
+			result = std::move(audit.m_results[index]);
+		}
+
+		// errors abort the audit just as they would sequentially, once the workers have stopped
+		if (result.error)
+		{
+			audit.m_next = audit.m_drivers.size();
+			osd_work_queue_wait(queue, WORK_QUEUE_WAIT_INFINITE);
+			osd_work_queue_free(queue);
+			std::rethrow_exception(result.error);
+		}
+		callback(audit.m_drivers[index], result.summary, result.details);
+	}
+
+	osd_work_queue_free(queue);
+}
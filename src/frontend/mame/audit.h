@@ -15,6 +15,10 @@
 
 #include "hash.h"
 
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
 
 
 //**************************************************************************
@@ -123,6 +127,31 @@ private:
 };
 
 
+// ======================> audit_file_cache
+
+// remembers the outcome of looking for and hashing individual files, so that
+// auditing many sets which share parents and BIOSes only touches each once
+class audit_file_cache
+{
+public:
+	// result of a single lookup
+	struct entry
+	{
+		bool                found;
+		UINT64              length;
+		hash_collection     hashes;
+	};
+
+	// lookups; safe to use from multiple threads
+	bool find(const std::string &key, entry &result) const;
+	void add(const std::string &key, const entry &result);
+
+private:
+	mutable std::mutex                          m_mutex;
+	std::unordered_map<std::string, entry>      m_entries;
+};
+
+
 // ======================> media_auditor
 
 // class which manages auditing of items
@@ -139,8 +168,11 @@ public:
 		NOTFOUND
 	};
 
+	// receives the result of auditing one driver in a parallel audit
+	typedef std::function<void (int drvindex, summary result, const std::string &details)> audit_callback;
+
 	// construction/destruction
-	media_auditor(const driver_enumerator &enumerator);
+	media_auditor(const driver_enumerator &enumerator, audit_file_cache *cache = nullptr);
 
 	// getters
 	const simple_list<audit_record> &records() const { return m_record_list; }
@@ -152,10 +184,15 @@ public:
 	summary audit_samples();
 	summary summarize(const char *name,std::string *output = nullptr);
 
+	// audit every driver included in the enumerator on worker threads; the
+	// callback is invoked on the calling thread in driver order
+	static void audit_media_parallel(const driver_enumerator &enumerator, const char *validation, audit_callback callback);
+
 private:
 	// internal helpers
 	audit_record *audit_one_rom(const rom_entry *rom);
 	audit_record *audit_one_disk(const rom_entry *rom, const char *locationtag = nullptr);
+	bool find_one_rom(const char *path, bool has_crc, UINT32 crc, audit_file_cache::entry &result);
 	void compute_status(audit_record &record, const rom_entry *rom, bool found);
 	device_t *find_shared_device(device_t &device, const char *name, const hash_collection &romhashes, UINT64 romlength);
 
@@ -164,6 +201,7 @@ private:
 	const driver_enumerator &   m_enumerator;
 	const char *                m_validation;
 	const char *                m_searchpath;
+	audit_file_cache *          m_cache;
 };
 
 
@@ -818,15 +818,11 @@ void cli_frontend::verifyroms(const char *gamename)
 	int notfound = 0;
 	int matched = 0;
 
-	// iterate over drivers
-	media_auditor auditor(drivlist);
-	while (drivlist.next())
+	// audit drivers in parallel; results come back in driver order
+	media_auditor::audit_media_parallel(drivlist, AUDIT_VALIDATE_FAST, [&] (int drvindex, media_auditor::summary summary, const std::string &summary_string)
 	{
 		matched++;
 
-		// audit the ROMs in this set
-		media_auditor::summary summary = auditor.audit_media(AUDIT_VALIDATE_FAST);
-
 		// if not found, count that and leave it at that
 		if (summary == media_auditor::NOTFOUND)
 			notfound++;
@@ -835,15 +831,13 @@ void cli_frontend::verifyroms(const char *gamename)
 		else
 		{
 			// output the summary of the audit
-			std::string summary_string;
-			auditor.summarize(drivlist.driver().name,&summary_string);
 			osd_printf_info("%s", summary_string.c_str());
 
 			// output the name of the driver and its clone
-			osd_printf_info("romset %s ", drivlist.driver().name);
-			int clone_of = drivlist.clone();
+			osd_printf_info("romset %s ", driver_list::driver(drvindex).name);
+			int clone_of = driver_list::clone(drvindex);
 			if (clone_of != -1)
-				osd_printf_info("[%s] ", drivlist.driver(clone_of).name);
+				osd_printf_info("[%s] ", driver_list::driver(clone_of).name);
 
 			// switch off of the result
 			switch (summary)
@@ -868,8 +862,10 @@ void cli_frontend::verifyroms(const char *gamename)
 					break;
 			}
 		}
-	}
+	});
 
+	// devices are audited one at a time below
+	media_auditor auditor(drivlist);
 	if (!matched || strchr(gamename, '*') || strchr(gamename, '?'))
 	{
 		driver_enumerator dummy_drivlist(m_options);
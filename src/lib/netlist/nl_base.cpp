@@ -128,10 +128,11 @@ void queue_t::on_pre_save()
 	netlist().log().debug("on_pre_save\n");
 	m_qsize = this->count();
 	netlist().log().debug("current time {1} qsize {2}\n", netlist().time().as_double(), m_qsize);
+	const entry_t *list = this->listptr();
 	for (int i = 0; i < m_qsize; i++ )
 	{
-		m_times[i] =  this->listptr()[i].exec_time().as_raw();
-		pstring p = this->listptr()[i].object()->name();
+		m_times[i] =  list[i].exec_time().as_raw();
+		pstring p = list[i].object()->name();
 		int n = p.len();
 		n = std::min(63, n);
 		std::strncpy(m_names[i].m_buf, p.cstr(), n);
@@ -254,6 +255,8 @@ ATTR_COLD void netlist_t::start()
 	pstring libpath = nl_util::environment("NL_BOOSTLIB", nl_util::buildpath({".", "nlboost.so"}));
 
 	m_lib = plib::palloc<plib::dynlib>(libpath);
+	if (m_lib->isLoaded())
+		log().verbose("Loaded static solver library {1}", libpath);
 
 	/* make sure the solver and parameters are started first! */
 
@@ -75,12 +75,6 @@
 
 #define USE_TRUTHTABLE          (1)
 
-// The following adds about 10% performance ...
-
-#if !defined(USE_OPENMP)
-#define USE_OPENMP              (0)
-#endif // !defined(USE_OPENMP)
-
 // Use nano-second resolution - Sufficient for now
 #define NETLIST_INTERNAL_RES        (U64(1000000000))
 //#define NETLIST_INTERNAL_RES      (U64(1000000000000))
@@ -89,6 +83,14 @@
 
 #define NETLIST_GMIN_DEFAULT    (1e-9)
 
+// Event queue implementation, see nl_lists.h
+//  0: sorted array, insertion sort on push. Fastest for typical netlists,
+//     new events are usually close to the head of the queue.
+//  1: binary heap, faster once several hundred events are pending
+#if !defined(NL_USE_HEAP_QUEUE)
+#define NL_USE_HEAP_QUEUE       (0)
+#endif // !defined(NL_USE_HEAP_QUEUE)
+
 //#define nl_double float
 //#define NL_FCONST(x) (x ## f)
 
@@ -118,12 +120,6 @@
 //  General Macros
 //============================================================
 
-#if defined(OPENMP)
-#define HAS_OPENMP ( OPENMP >= 200805 )
-#else
-#define HAS_OPENMP (0)
-#endif
-
 //============================================================
 //  Performance tracking
 //============================================================
@@ -143,15 +139,5 @@
 // this macro passes an item followed by a string version of itself as two consecutive parameters
 #define NLNAME(x) x, #x
 
-//============================================================
-//  WARNINGS
-//============================================================
-
-#if (USE_OPENMP)
-#if (!(HAS_OPENMP))
-#error To use openmp compile and link with "-fopenmp"
-#endif
-#endif
-
 
 #endif /* NLCONFIG_H_ */
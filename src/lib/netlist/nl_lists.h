@@ -13,19 +13,20 @@
 #include "nl_config.h"
 #include "plib/plists.h"
 
+#include <algorithm>
 #include <atomic>
 
 
 // ----------------------------------------------------------------------------------------
-// timed queue
+// timed queue - sorted array
 // ----------------------------------------------------------------------------------------
 
 namespace netlist
 {
 	template <class Element, class Time>
-	class timed_queue
+	class timed_queue_linear
 	{
-		P_PREVENT_COPYING(timed_queue)
+		P_PREVENT_COPYING(timed_queue_linear)
 	public:
 
 		class entry_t
@@ -55,12 +56,9 @@ namespace netlist
 			Element m_object;
 		};
 
-		timed_queue(unsigned list_size)
+		timed_queue_linear(unsigned list_size)
 		: m_list(list_size)
 		{
-	#if HAS_OPENMP && USE_OPENMP
-			m_lock = 0;
-	#endif
 			clear();
 		}
 
@@ -70,10 +68,6 @@ namespace netlist
 
 		ATTR_HOT void push(const entry_t e) NOEXCEPT
 		{
-	#if HAS_OPENMP && USE_OPENMP
-			/* Lock */
-			while (m_lock.exchange(1)) { }
-	#endif
 #if 1
 			const Time t = e.exec_time();
 			entry_t * i = m_end++;
@@ -95,9 +89,6 @@ namespace netlist
 			*i = e;
 #endif
 			inc_stat(m_prof_call);
-	#if HAS_OPENMP && USE_OPENMP
-			m_lock = 0;
-	#endif
 			//nl_assert(m_end - m_list < Size);
 		}
 
@@ -113,10 +104,6 @@ namespace netlist
 
 		ATTR_HOT  void remove(const Element &elem) NOEXCEPT
 		{
-			/* Lock */
-	#if HAS_OPENMP && USE_OPENMP
-			while (m_lock.exchange(1)) { }
-	#endif
 			for (entry_t * i = m_end - 1; i > &m_list[0]; i--)
 			{
 				if (i->object() == elem)
@@ -127,15 +114,9 @@ namespace netlist
 						*i = *(i+1);
 						i++;
 					}
-	#if HAS_OPENMP && USE_OPENMP
-					m_lock = 0;
-	#endif
 					return;
 				}
 			}
-	#if HAS_OPENMP && USE_OPENMP
-			m_lock = 0;
-	#endif
 		}
 
 		ATTR_COLD void clear()
@@ -163,13 +144,187 @@ namespace netlist
 
 	private:
 
-	#if HAS_OPENMP && USE_OPENMP
-		volatile std::atomic<int> m_lock;
-	#endif
 		entry_t * m_end;
 		plib::array_t<entry_t> m_list;
 	};
 
+// ----------------------------------------------------------------------------------------
+// timed queue - binary heap
+//
+// push and remove are O(log n) instead of O(n) moves. Entries with equal
+// time are returned last in, first out like in timed_queue_linear, so both
+// queues process events in exactly the same order.
+// ----------------------------------------------------------------------------------------
+
+	template <class Element, class Time>
+	class timed_queue_heap
+	{
+		P_PREVENT_COPYING(timed_queue_heap)
+	public:
+
+		class entry_t
+		{
+			friend class timed_queue_heap;
+		public:
+			ATTR_HOT  entry_t()
+			:  m_exec_time(), m_object(), m_seq(0) {}
+			ATTR_HOT  entry_t(const Time &atime, const Element &elem) NOEXCEPT
+			: m_exec_time(atime), m_object(elem), m_seq(0)  {}
+			ATTR_HOT  const Time &exec_time() const { return m_exec_time; }
+			ATTR_HOT  const Element &object() const { return m_object; }
+		private:
+			Time m_exec_time;
+			Element m_object;
+			UINT64 m_seq;
+		};
+
+		timed_queue_heap(unsigned list_size)
+		: m_list(list_size), m_sorted(list_size), m_sorted_valid(false)
+		{
+			clear();
+		}
+
+		ATTR_HOT  std::size_t capacity() const { return m_list.size(); }
+		ATTR_HOT  bool is_empty() const { return (m_count == 0); }
+		ATTR_HOT  bool is_not_empty() const { return (m_count > 0); }
+
+		ATTR_HOT void push(const entry_t e) NOEXCEPT
+		{
+			entry_t n(e);
+			n.m_seq = m_seq++;
+			sift_up(m_count++, n);
+			m_sorted_valid = false;
+			inc_stat(m_prof_call);
+			//nl_assert(m_count <= m_list.size());
+		}
+
+		/* The returned entry stays valid until the next push */
+		ATTR_HOT  const entry_t & pop() NOEXCEPT
+		{
+			const entry_t last = m_list[--m_count];
+			m_sorted_valid = false;
+			if (m_count > 0)
+			{
+				std::swap(m_list[0], m_list[m_count]);
+				sift_down(0, last);
+			}
+			return m_list[m_count];
+		}
+
+		ATTR_HOT  const entry_t & top() const NOEXCEPT
+		{
+			return m_list[0];
+		}
+
+		ATTR_HOT  void remove(const Element &elem) NOEXCEPT
+		{
+			for (std::size_t i = 0; i < m_count; i++)
+			{
+				if (m_list[i].object() == elem)
+				{
+					const entry_t last = m_list[--m_count];
+					m_sorted_valid = false;
+					if (i < m_count)
+					{
+						if (i > 0 && before(last, m_list[(i - 1) / 2]))
+							sift_up(i, last);
+						else
+							sift_down(i, last);
+					}
+					return;
+				}
+			}
+		}
+
+		ATTR_COLD void clear()
+		{
+			m_count = 0;
+			m_seq = 0;
+			m_sorted_valid = false;
+		}
+
+		// save state support & mame disasm
+		// Same layout as timed_queue_linear: the next entry is last.
+		// The sorted view is only rebuilt after the queue has changed.
+
+		ATTR_COLD  const entry_t *listptr() const { sort_list(); return &m_sorted[0]; }
+		ATTR_HOT  int count() const { return m_count; }
+		ATTR_COLD  const entry_t & operator[](const int & index) const { sort_list(); return m_sorted[index]; }
+
+	#if (NL_KEEP_STATISTICS)
+		// profiling
+		INT32   m_prof_sortmove;
+		INT32   m_prof_call;
+	#endif
+
+	private:
+
+		static inline bool before(const entry_t &a, const entry_t &b)
+		{
+			return (a.m_exec_time < b.m_exec_time)
+				|| (a.m_exec_time == b.m_exec_time && a.m_seq > b.m_seq);
+		}
+
+		/* place e at hole i or above */
+		inline void sift_up(std::size_t i, const entry_t &e) NOEXCEPT
+		{
+			while (i > 0)
+			{
+				const std::size_t parent = (i - 1) / 2;
+				if (!before(e, m_list[parent]))
+					break;
+				m_list[i] = m_list[parent];
+				i = parent;
+				inc_stat(m_prof_sortmove);
+			}
+			m_list[i] = e;
+		}
+
+		/* place e at hole i or below */
+		inline void sift_down(std::size_t i, const entry_t &e) NOEXCEPT
+		{
+			for (;;)
+			{
+				std::size_t child = 2 * i + 1;
+				if (child >= m_count)
+					break;
+				if (child + 1 < m_count && before(m_list[child + 1], m_list[child]))
+					child++;
+				if (!before(m_list[child], e))
+					break;
+				m_list[i] = m_list[child];
+				i = child;
+				inc_stat(m_prof_sortmove);
+			}
+			m_list[i] = e;
+		}
+
+		ATTR_COLD void sort_list() const
+		{
+			if (m_sorted_valid)
+				return;
+			m_sorted_valid = true;
+			for (std::size_t i = 0; i < m_count; i++)
+				m_sorted[i] = m_list[i];
+			std::sort(&m_sorted[0], &m_sorted[0] + m_count,
+					[](const entry_t &a, const entry_t &b) { return before(b, a); });
+		}
+
+		std::size_t m_count;
+		UINT64 m_seq;
+		plib::array_t<entry_t> m_list;
+		mutable plib::array_t<entry_t> m_sorted;
+		mutable bool m_sorted_valid;
+	};
+
+#if (NL_USE_HEAP_QUEUE)
+	template <class Element, class Time>
+	using timed_queue = timed_queue_heap<Element, Time>;
+#else
+	template <class Element, class Time>
+	using timed_queue = timed_queue_linear<Element, Time>;
+#endif
+
 }
 
 #endif /* NLLISTS_H_ */
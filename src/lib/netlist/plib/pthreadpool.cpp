@@ -0,0 +1,97 @@
+// license:GPL-2.0+
+// copyright-holders:agent
+/*
+ * pthreadpool.c
+ *
+ */
+
+#include "pthreadpool.h"
+
+PLIB_NAMESPACE_START()
+
+/* iterations a thread polls before blocking on the condition variable */
+static const unsigned SPIN_COUNT = 64;
+
+thread_pool::thread_pool(const unsigned threads)
+: m_exit(false), m_func(nullptr), m_count(0), m_next(0), m_generation(0), m_busy(0)
+{
+	for (unsigned i = 1; i < threads; i++)
+		m_workers.push_back(std::thread(&thread_pool::worker_proc, this));
+}
+
+thread_pool::~thread_pool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		m_exit = true;
+	}
+	m_wakeup.notify_all();
+	for (auto &t : m_workers)
+		t.join();
+}
+
+void thread_pool::run(const std::size_t count, const work_func &func)
+{
+	if (m_workers.empty() || count < 2)
+	{
+		for (std::size_t i = 0; i < count; i++)
+			func(i);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		m_func = &func;
+		m_count = count;
+		m_next.store(0, std::memory_order_relaxed);
+		m_busy.store(static_cast<unsigned>(m_workers.size()), std::memory_order_relaxed);
+		m_generation.fetch_add(1, std::memory_order_release);
+	}
+	m_wakeup.notify_all();
+
+	process();
+
+	/* every worker acknowledges the generation, so m_func stays valid */
+	for (unsigned spin = 0; spin < SPIN_COUNT && m_busy.load(std::memory_order_acquire) != 0; spin++)
+		std::this_thread::yield();
+	{
+		std::unique_lock<std::mutex> lock(m_lock);
+		m_finished.wait(lock, [this]() { return m_busy.load(std::memory_order_acquire) == 0; });
+	}
+	m_func = nullptr;
+}
+
+void thread_pool::process()
+{
+	std::size_t i;
+	while ((i = m_next.fetch_add(1, std::memory_order_acq_rel)) < m_count)
+		(*m_func)(i);
+}
+
+void thread_pool::worker_proc()
+{
+	unsigned seen = 0;
+
+	for (;;)
+	{
+		for (unsigned spin = 0; spin < SPIN_COUNT && m_generation.load(std::memory_order_acquire) == seen; spin++)
+			std::this_thread::yield();
+
+		{
+			std::unique_lock<std::mutex> lock(m_lock);
+			m_wakeup.wait(lock, [this, seen]() { return m_exit || m_generation.load(std::memory_order_relaxed) != seen; });
+			if (m_exit)
+				return;
+			seen = m_generation.load(std::memory_order_relaxed);
+		}
+
+		process();
+		if (m_busy.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			std::lock_guard<std::mutex> lock(m_lock);
+			m_finished.notify_one();
+		}
+	}
+}
+
+PLIB_NAMESPACE_END()
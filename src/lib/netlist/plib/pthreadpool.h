@@ -0,0 +1,67 @@
+// license:GPL-2.0+
+// copyright-holders:agent
+/*
+ * pthreadpool.h
+ *
+ */
+
+#ifndef PTHREADPOOL_H_
+#define PTHREADPOOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "pconfig.h"
+
+PLIB_NAMESPACE_START()
+
+// ----------------------------------------------------------------------------------------
+// thread_pool: run independent work items on a fixed set of threads
+// ----------------------------------------------------------------------------------------
+
+/*
+ * The calling thread takes part in processing, so a pool created with
+ * n threads starts n - 1 workers. run() returns after all items have
+ * been processed. Workers and the caller poll briefly for back-to-back
+ * steps and otherwise block, so idle pools don't use any CPU.
+ */
+
+class thread_pool
+{
+	P_PREVENT_COPYING(thread_pool)
+public:
+	using work_func = std::function<void(const std::size_t)>;
+
+	explicit thread_pool(const unsigned threads);
+	~thread_pool();
+
+	unsigned threads() const { return static_cast<unsigned>(m_workers.size()) + 1; }
+
+	/* call func(i) for i in [0, count) */
+	void run(const std::size_t count, const work_func &func);
+
+private:
+	void process();
+	void worker_proc();
+
+	std::vector<std::thread> m_workers;
+
+	std::mutex m_lock;
+	std::condition_variable m_wakeup;
+	std::condition_variable m_finished;
+	bool m_exit;
+
+	const work_func *m_func;
+	std::size_t m_count;
+	std::atomic<std::size_t> m_next;
+	std::atomic<unsigned> m_generation;
+	std::atomic<unsigned> m_busy;
+};
+
+PLIB_NAMESPACE_END()
+
+#endif /* PTHREADPOOL_H_ */
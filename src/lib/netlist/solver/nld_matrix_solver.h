@@ -94,6 +94,8 @@ public:
 	m_iterative_total(0),
 	m_params(*params),
 	m_cur_ts(0),
+	m_publish(false),
+	m_nr_exceeded(false),
 	m_sort(sort)
 	{
 		enregister("Q_sync", m_Q_sync);
@@ -117,6 +119,13 @@ public:
 
 	const netlist_time solve();
 
+	/* solve() is split into the matrix calculation, which touches only
+	 * nets and devices of this solver and may run concurrently with other
+	 * solvers, and publishing the results to the queue and inputs.
+	 */
+	const netlist_time solve_unpublished();
+	void publish();
+
 	inline bool has_dynamic_devices() const { return m_dynamic_devices.size() > 0; }
 	inline bool has_timestep_devices() const { return m_step_devices.size() > 0; }
 
@@ -139,7 +148,7 @@ public:
 
 	virtual void create_solver_code(plib::postream &strm)
 	{
-		strm.writeline(plib::pfmt("/* {1} doesn't support static compile */"));
+		strm.writeline(plib::pfmt("/* {1} doesn't support static compile */")(name()));
 	}
 
 protected:
@@ -182,6 +191,8 @@ private:
 
 	netlist_time m_last_step;
 	nl_double m_cur_ts;
+	bool m_publish;
+	bool m_nr_exceeded;
 	dev_list_t m_step_devices;
 	dev_list_t m_dynamic_devices;
 
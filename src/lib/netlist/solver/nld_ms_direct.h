@@ -160,6 +160,11 @@ protected:
 #endif
 	ATTR_ALIGN nl_double m_last_RHS[storage_N]; // right hand side - contains currents
 
+	/* number of contiguous columns starting at m_nzrd[0] used for row
+	 * operations, 0 if the row is too sparse and m_nzrd is used instead.
+	 */
+	unsigned m_dense_span[storage_N];
+
 private:
 	static const std::size_t m_pitch = (((storage_N + 1) + 7) / 8) * 8;
 	//static const std::size_t m_pitch = (((storage_N + 1) + 15) / 16) * 16;
@@ -207,6 +212,17 @@ ATTR_COLD void matrix_solver_direct_t<m_N, storage_N>::vsetup(analog_net_t::list
 			t->m_nzrd.push_back(N());
 	}
 
+	/* Rows with a mostly occupied span right of the diagonal are processed
+	 * as one contiguous block which the compiler can vectorize. Elements
+	 * in the span not listed in m_nzrd are zero and stay zero.
+	 */
+	for (unsigned k = 0; k < N(); k++)
+	{
+		const auto &nzrd = m_terms[k]->m_nzrd;
+		const unsigned span = N() + 1 - nzrd[0];
+		m_dense_span[k] = (2 * nzrd.size() >= span) ? span : 0;
+	}
+
 	save(NLNAME(m_last_RHS));
 
 	for (unsigned k = 0; k < N(); k++)
@@ -327,15 +343,26 @@ void matrix_solver_direct_t<m_N, storage_N>::LE_solve()
 			const nl_double f = 1.0 / A(i,i);
 			const auto &nzrd = m_terms[i]->m_nzrd;
 			const auto &nzbd = m_terms[i]->m_nzbd;
+			const unsigned span = m_dense_span[i];
 
-			for (auto & j : nzbd)
+			if (span > 0)
 			{
-				const nl_double f1 = -f * A(j,i);
-				for (auto & k : nzrd)
-					A(j,k) += A(i,k) * f1;
-				//RHS(j) += RHS(i) * f1;
-#endif
+				const unsigned c = nzrd[0];
+				const nl_ext_double * RESTRICT pi = &A(i,c);
+				for (auto & j : nzbd)
+					vec_add_mult_scalar(span, pi, -f * A(j,i), &A(j,c));
+			}
+			else
+			{
+				for (auto & j : nzbd)
+				{
+					const nl_double f1 = -f * A(j,i);
+					for (auto & k : nzrd)
+						A(j,k) += A(i,k) * f1;
+					//RHS(j) += RHS(i) * f1;
+				}
 			}
+#endif
 		}
 	}
 }
@@ -365,12 +392,22 @@ void matrix_solver_direct_t<m_N, storage_N>::LE_back_subst(
 			T tmp = 0;
 
 			const auto *p = m_terms[j]->m_nzrd.data();
-			const auto e = m_terms[j]->m_nzrd.size() - 1; /* exclude RHS element */
+			const unsigned span = m_dense_span[j];
 
-			for (unsigned k = 0; k < e; k++)
+			if (span > 0)
+			{
+				/* x[k] for k > j is already known, exclude RHS element */
+				tmp = vecmult(span - 1, &A(j,p[0]), &x[p[0]]);
+			}
+			else
 			{
-				const auto pk = p[k];
-				tmp += A(j,pk) * x[pk];
+				const auto e = m_terms[j]->m_nzrd.size() - 1; /* exclude RHS element */
+
+				for (unsigned k = 0; k < e; k++)
+				{
+					const auto pk = p[k];
+					tmp += A(j,pk) * x[pk];
+				}
 			}
 			x[j] = (RHS(j) - tmp) / A(j,j);
 		}
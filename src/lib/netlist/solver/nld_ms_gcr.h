@@ -66,6 +66,8 @@ private:
 
 	unsigned m_dim;
 	plib::pvector_t<int> m_term_cr[storage_N];
+	/* compressed row positions written by each elimination step */
+	plib::pvector_t<unsigned> m_elim;
 	mat_cr_t<storage_N> mat;
 	nl_double m_A[storage_N * storage_N];
 
@@ -162,6 +164,31 @@ void matrix_solver_GCR_t<m_N, storage_N>::vsetup(analog_net_t::list_t &nets)
 	mat.ia[iN] = nz;
 	mat.nz_num = nz;
 
+	/* Resolve the column merge of the elimination once. For each pivot i
+	 * and each row j below it this stores the position of A(j,i) followed
+	 * by the positions in row j matching row i right of the diagonal.
+	 */
+	m_elim.clear();
+	for (unsigned i = 0; i < iN - 1; i++)
+	{
+		const unsigned pi = mat.diag[i] + 1;
+		const unsigned piie = mat.ia[i+1];
+
+		for (auto & j : this->m_terms[i]->m_nzbd)
+		{
+			unsigned pj = mat.ia[j];
+			while (mat.ja[pj] < i)
+				pj++;
+			m_elim.push_back(pj++);
+			for (unsigned pii = pi; pii < piie; pii++)
+			{
+				while (mat.ja[pj] < mat.ja[pii])
+					pj++;
+				m_elim.push_back(pj++);
+			}
+		}
+	}
+
 	this->log().verbose("Ops: {1}  Occupancy ratio: {2}\n", ops, (double) nz / double (iN * iN));
 
 	// FIXME: Move me
@@ -227,11 +254,16 @@ template <unsigned m_N, unsigned storage_N>
 void matrix_solver_GCR_t<m_N, storage_N>::create_solver_code(plib::postream &strm)
 {
 	//const unsigned iN = N();
+	const pstring name = static_compile_name();
 
-	strm.writeline(plib::pfmt("extern \"C\" void {1}(double * _restrict m_A, double * _restrict RHS)")(static_compile_name()));
+	/* identical matrices share a kernel, emit it only once */
+	strm.writeline(plib::pfmt("#ifndef {1}_DEFINED")(name));
+	strm.writeline(plib::pfmt("#define {1}_DEFINED")(name));
+	strm.writeline(plib::pfmt("NL_SOLVER_EXPORT void {1}(double * __restrict m_A, double * __restrict RHS)")(name));
 	strm.writeline("{");
 	csc_private(strm);
 	strm.writeline("}");
+	strm.writeline("#endif");
 }
 
 
@@ -307,6 +339,8 @@ int matrix_solver_GCR_t<m_N, storage_N>::vsolve_non_dynamic(const bool newton_ra
 	}
 	else
 	{
+		const unsigned * RESTRICT pe = m_elim.data();
+
 		for (unsigned i = 0; i < iN - 1; i++)
 		{
 			const auto &nzbd = this->m_terms[i]->m_nzbd;
@@ -315,26 +349,17 @@ int matrix_solver_GCR_t<m_N, storage_N>::vsolve_non_dynamic(const bool newton_ra
 			{
 				unsigned pi = mat.diag[i];
 				const nl_double f = 1.0 / m_A[pi++];
-				const unsigned piie = mat.ia[i+1];
+				const unsigned e = mat.ia[i+1] - pi;
+				const nl_double * const pa = &m_A[pi];
 
 				for (auto & j : nzbd)
 				{
-					// proceed to column i
-					//__builtin_prefetch(&m_A[mat.diag[j+1]], 1);
-					unsigned pj = mat.ia[j];
-
-					while (mat.ja[pj] < i)
-						pj++;
-
-					const nl_double f1 = - m_A[pj++] * f;
+					const nl_double f1 = - m_A[*pe++] * f;
 
 					// subtract row i from j */
-					for (unsigned pii = pi; pii<piie; )
-					{
-						while (mat.ja[pj] < mat.ja[pii])
-							pj++;
-						m_A[pj++] += m_A[pii++] * f1;
-					}
+					for (unsigned k = 0; k < e; k++)
+						m_A[pe[k]] += pa[k] * f1;
+					pe += e;
 					RHS[j] += f1 * RHS[i];
 				}
 			}
@@ -34,10 +34,6 @@
 //#include "nld_twoterm.h"
 #include "nl_lists.h"
 
-#if HAS_OPENMP
-#include "omp.h"
-#endif
-
 #include "nld_solver.h"
 #include "nld_matrix_solver.h"
 
@@ -421,12 +417,8 @@ const netlist_time matrix_solver_t::solve_base()
 		} while (this_resched > 1 && newton_loops < m_params.m_nr_loops);
 
 		m_stat_newton_raphson += newton_loops;
-		// reschedule ....
-		if (this_resched > 1 && !m_Q_sync.net().is_queued())
-		{
-			log().warning("NEWTON_LOOPS exceeded on net {1}... reschedule", this->name());
-			m_Q_sync.net().reschedule_in_queue(m_params.m_nt_sync_delay);
-		}
+		// reschedule in publish()
+		m_nr_exceeded = (this_resched > 1);
 	}
 	else
 	{
@@ -436,6 +428,14 @@ const netlist_time matrix_solver_t::solve_base()
 }
 
 const netlist_time matrix_solver_t::solve()
+{
+	const netlist_time next_time_step = solve_unpublished();
+
+	publish();
+	return next_time_step;
+}
+
+const netlist_time matrix_solver_t::solve_unpublished()
 {
 	const netlist_time now = netlist().time();
 	const netlist_time delta = now - m_last_step;
@@ -448,13 +448,27 @@ const netlist_time matrix_solver_t::solve()
 	/* update all terminals for new time step */
 	m_last_step = now;
 	m_cur_ts = delta.as_double();
+	m_publish = true;
 
 	step(delta);
 
-	const netlist_time next_time_step = solve_base();
+	return solve_base();
+}
+
+void matrix_solver_t::publish()
+{
+	if (!m_publish)
+		return;
+	m_publish = false;
+
+	if (m_nr_exceeded && !m_Q_sync.net().is_queued())
+	{
+		log().warning("NEWTON_LOOPS exceeded on net {1}... reschedule", this->name());
+		m_Q_sync.net().reschedule_in_queue(m_params.m_nt_sync_delay);
+	}
+	m_nr_exceeded = false;
 
 	update_inputs();
-	return next_time_step;
 }
 
 ATTR_COLD int matrix_solver_t::get_net_idx(net_t *net)
@@ -584,36 +598,21 @@ NETLIB_UPDATE(solver)
 		return;
 
 
-#if HAS_OPENMP && USE_OPENMP
-	const std::size_t t_cnt = m_mat_solvers.size();
-	if (m_parallel.Value())
+	if (m_thread_pool)
 	{
-		omp_set_num_threads(3);
-		//omp_set_dynamic(0);
-		#pragma omp parallel
+		/* matrices are independent, only publishing touches the queue */
+		m_thread_pool->run(m_step_solvers.size(), [this](const std::size_t i)
 		{
-			#pragma omp for
-			for (int i = 0; i <  t_cnt; i++)
-				if (m_mat_solvers[i]->has_timestep_devices())
-				{
-					// Ignore return value
-					ATTR_UNUSED const netlist_time ts = m_mat_solvers[i]->solve();
-				}
-		}
+			// Ignore return value
+			ATTR_UNUSED const netlist_time ts = m_step_solvers[i]->solve_unpublished();
+		});
+		for (auto & solver : m_step_solvers)
+			solver->publish();
 	}
 	else
-		for (int i = 0; i < t_cnt; i++)
-			if (m_mat_solvers[i]->has_timestep_devices())
-			{
-				// Ignore return value
-				ATTR_UNUSED const netlist_time ts = m_mat_solvers[i]->solve();
-			}
-#else
-	for (auto & solver : m_mat_solvers)
-		if (solver->has_timestep_devices())
+		for (auto & solver : m_step_solvers)
 			// Ignore return value
 			ATTR_UNUSED const netlist_time ts = solver->solve();
-#endif
 
 	/* step circuit */
 	if (!m_Q_step.net().is_queued())
@@ -838,10 +837,33 @@ ATTR_COLD void NETLIB_NAME(solver)::post_start()
 			}
 		}
 	}
+
+	for (auto & ms : m_mat_solvers)
+		if (ms->has_timestep_devices())
+			m_step_solvers.push_back(ms);
+
+	/* dynamic time step solvers are updated individually by the queue */
+	const std::size_t threads = std::min<std::size_t>(std::max(m_parallel.Value(), 0), m_step_solvers.size());
+	if (!m_params.m_dynamic && threads > 1)
+	{
+		netlist().log().verbose("Solving {1} matrices on {2} threads", m_step_solvers.size(), threads);
+		m_thread_pool = plib::pmake_unique<plib::thread_pool>(threads);
+	}
 }
 
 void NETLIB_NAME(solver)::create_solver_code(plib::postream &strm)
 {
+	/* Output of several netlists may be concatenated into one file
+	 * which is built as a shared library, see nlboost.so in build/makefile.
+	 */
+	strm.writeline("#ifndef NL_SOLVER_EXPORT");
+	strm.writeline("#if defined(_WIN32)");
+	strm.writeline("#define NL_SOLVER_EXPORT extern \"C\" __declspec(dllexport)");
+	strm.writeline("#else");
+	strm.writeline("#define NL_SOLVER_EXPORT extern \"C\"");
+	strm.writeline("#endif");
+	strm.writeline("#endif");
+
 	for (auto & s : m_mat_solvers)
 		s->create_solver_code(strm);
 }
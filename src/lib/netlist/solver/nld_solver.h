@@ -11,6 +11,7 @@
 #include "nl_setup.h"
 #include "nl_base.h"
 #include "plib/pstream.h"
+#include "plib/pthreadpool.h"
 
 //#define ATTR_ALIGNED(N) __attribute__((aligned(N)))
 #define ATTR_ALIGNED(N) ATTR_ALIGN
@@ -68,7 +69,7 @@ NETLIB_OBJECT(solver)
 	, m_gmin(*this, "GMIN", NETLIST_GMIN_DEFAULT)
 	, m_pivot(*this, "PIVOT", 0)                    // use pivoting - on supported solvers
 	, m_nr_loops(*this, "NR_LOOPS", 250)            // Newton-Raphson loops
-	, m_parallel(*this, "PARALLEL", 0)
+	, m_parallel(*this, "PARALLEL", 0)             // threads solving independent matrices
 
 	/* automatic time step */
 	, m_dynamic(*this, "DYNAMIC_TS", 0)
@@ -123,6 +124,9 @@ protected:
 	plib::pvector_t<matrix_solver_t *> m_mat_solvers;
 private:
 
+	plib::pvector_t<matrix_solver_t *> m_step_solvers;
+	std::unique_ptr<plib::thread_pool> m_thread_pool;
+
 	solver_parameters_t m_params;
 
 	template <int m_N, int storage_N>
@@ -0,0 +1,113 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles, Vas Crabb
+/***************************************************************************
+
+    arcindex.cpp
+
+    Hashed lookup of archive members by CRC and name.
+
+***************************************************************************/
+
+#include "arcindex.h"
+
+#include <algorithm>
+#include <cctype>
+
+
+namespace util {
+/*-------------------------------------------------
+    normalize - fold a name to lowercase the same
+    way core_stricmp does
+-------------------------------------------------*/
+
+std::string archive_index::normalize(const std::string &name)
+{
+	std::string result(name);
+	std::transform(result.begin(), result.end(), result.begin(), [] (char c) { return char(std::tolower(std::uint8_t(c))); });
+	return result;
+}
+
+
+/*-------------------------------------------------
+    add - add a regular file member to the index
+-------------------------------------------------*/
+
+void archive_index::add(std::size_t index, const std::string &name, bool has_crc, std::uint32_t crc)
+{
+	if (has_crc)
+		m_crcs.emplace(crc, index);
+
+	std::string const lower(normalize(name));
+	m_names.emplace(lower, index);
+
+	// a partial path must begin after a path separator
+	for (auto sep = lower.find('/'); sep != std::string::npos; sep = lower.find('/', sep + 1))
+		m_partials.emplace(lower.substr(sep + 1), index);
+}
+
+
+/*-------------------------------------------------
+    clear - remove all members
+-------------------------------------------------*/
+
+void archive_index::clear()
+{
+	m_crcs.clear();
+	m_names.clear();
+	m_partials.clear();
+}
+
+
+/*-------------------------------------------------
+    find - return the lowest member index that
+    matches, or -1 if nothing does
+-------------------------------------------------*/
+
+int archive_index::find(std::uint32_t crc, const std::string &name, bool matchcrc, bool matchname, bool partialpath) const
+{
+	std::size_t best = std::size_t(-1);
+
+	if (matchname)
+	{
+		// candidates are names that match, optionally filtered by CRC
+		std::string const lower(normalize(name));
+		auto const consider = [this, crc, matchcrc, &best] (name_map::const_iterator begin, name_map::const_iterator end)
+		{
+			for ( ; begin != end; ++begin)
+			{
+				if ((begin->second < best) && (!matchcrc || has_crc(begin->second, crc)))
+					best = begin->second;
+			}
+		};
+
+		auto const names = m_names.equal_range(lower);
+		consider(names.first, names.second);
+		if (partialpath)
+		{
+			auto const partials = m_partials.equal_range(lower);
+			consider(partials.first, partials.second);
+		}
+	}
+	else if (matchcrc)
+	{
+		auto const crcs = m_crcs.equal_range(crc);
+		for (auto it = crcs.first; it != crcs.second; ++it)
+			best = (std::min)(best, it->second);
+	}
+
+	return (best != std::size_t(-1)) ? int(best) : -1;
+}
+
+
+/*-------------------------------------------------
+    has_crc - check whether a member has the
+    given CRC
+-------------------------------------------------*/
+
+bool archive_index::has_crc(std::size_t index, std::uint32_t crc) const
+{
+	auto const crcs = m_crcs.equal_range(crc);
+	return std::find_if(crcs.first, crcs.second, [index] (crc_map::value_type const &entry) { return entry.second == index; }) != crcs.second;
+}
+
+} // namespace util
@@ -0,0 +1,58 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles, Vas Crabb
+/***************************************************************************
+
+    arcindex.h
+
+    Hashed lookup of archive members by CRC and name.
+
+***************************************************************************/
+
+#pragma once
+
+#ifndef MAME_LIB_UTIL_ARCINDEX_H
+#define MAME_LIB_UTIL_ARCINDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+
+namespace util {
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+// maps CRCs and names to member indices so archives don't need a linear
+// scan of their directory for every search; only regular files are indexed
+// since searches by CRC or name never match directories
+class archive_index
+{
+public:
+	// add a member; members must be added in ascending index order
+	void add(std::size_t index, const std::string &name, bool has_crc, std::uint32_t crc);
+
+	// remove all members
+	void clear();
+
+	// find the lowest member index matching the criteria, or -1 if there is none;
+	// name matches are case-insensitive and a partial path matches any trailing
+	// sequence of complete path components
+	int find(std::uint32_t crc, const std::string &name, bool matchcrc, bool matchname, bool partialpath) const;
+
+private:
+	typedef std::unordered_multimap<std::uint32_t, std::size_t> crc_map;
+	typedef std::unordered_multimap<std::string, std::size_t> name_map;
+
+	static std::string normalize(const std::string &name);
+	bool has_crc(std::size_t index, std::uint32_t crc) const;
+
+	crc_map     m_crcs;         // members by CRC
+	name_map    m_names;        // members by lowercase full name
+	name_map    m_partials;     // members by lowercase trailing path components
+};
+
+} // namespace util
+
+#endif  // MAME_LIB_UTIL_ARCINDEX_H
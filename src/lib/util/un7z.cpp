@@ -12,6 +12,7 @@
 
 #include "unzip.h"
 
+#include "arcindex.h"
 #include "corestr.h"
 #include "unicode.h"
 
@@ -25,8 +26,12 @@
 #include <cassert>
 #include <cstdio>
 #include <cstdlib>
+#include <condition_variable>
 #include <cstring>
+#include <list>
+#include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -86,6 +91,51 @@ struct CFileInStream : public ISeekInStream, public CSzFile
 };
 
 
+// a fully decoded solid block (7z folder), shared by every open of the
+// archive so extracting N members from one block only decodes it once;
+// blocks are dropped when their archive leaves the open file cache
+struct solid_block
+{
+	solid_block() : ready(false), result(SZ_OK) { }
+
+	bool                ready;      // decoding has finished
+	SRes                result;     // result of decoding
+	std::vector<Byte>   data;       // decoded contents
+};
+
+
+class solid_block_cache
+{
+public:
+	typedef std::shared_ptr<solid_block> block_ptr;
+
+	// find a block, or claim it for decoding if nobody has yet; waits for
+	// another thread that is already decoding the same block
+	static block_ptr acquire(const std::string &key, bool &claimed);
+
+	// publish the result of decoding a claimed block
+	static void complete(const std::string &key, const block_ptr &block, SRes result);
+
+	// drop blocks belonging to an archive
+	static void release(const std::string &filename);
+
+	// drop everything
+	static void clear();
+
+private:
+	typedef std::list<std::pair<std::string, block_ptr> > block_list;
+
+	static void trim();
+
+	static constexpr std::size_t    MAX_CACHED_BYTES = 32 * 1024 * 1024;    // decoded data to keep around
+	static std::mutex               s_mutex;
+	static std::condition_variable  s_ready;
+	static block_list               s_lru;
+	static std::unordered_map<std::string, block_list::iterator> s_map;
+	static std::size_t              s_bytes;
+};
+
+
 class  m7z_file_impl
 {
 public:
@@ -94,10 +144,10 @@ public:
 	m7z_file_impl(const std::string &filename);
 	~m7z_file_impl()
 	{
-		if (m_out_buffer)
-			IAlloc_Free(&m_alloc_imp, m_out_buffer);
 		if (m_inited)
 			SzArEx_Free(&m_db, &m_alloc_imp);
+		m_block.reset();
+		solid_block_cache::release(m_filename);
 	}
 
 	static ptr find_cached(const std::string &filename)
@@ -122,6 +172,8 @@ public:
 		// clear call cache entries
 		std::lock_guard<std::mutex> guard(s_cache_mutex);
 		for (std::size_t cachenum = 0; cachenum < s_cache.size(); s_cache[cachenum++].reset()) { }
+		s_directory_lru.clear();
+		s_directory_map.clear();
 	}
 
 	archive_file::error initialize();
@@ -150,6 +202,28 @@ public:
 	archive_file::error decompress(void *buffer, std::uint32_t length);
 
 private:
+	// the 7z signature header, which locates and checksums the archive header
+	typedef std::array<std::uint8_t, 32> start_header;
+
+	// archive member list, shared by every open of the same archive
+	struct m7z_directory
+	{
+		struct entry
+		{
+			std::string     name;               // UTF-8 name
+			bool            is_dir;             // entry is a directory
+			std::uint64_t   length;             // uncompressed length
+			std::uint32_t   crc;                // CRC or zero if not present
+		};
+
+		std::uint64_t       length;             // archive length when read
+		start_header        header;             // archive signature header when read
+		std::vector<entry>  entries;            // members in order
+		archive_index       index;              // lookup by CRC and name
+	};
+	typedef std::shared_ptr<m7z_directory const> directory_ptr;
+	typedef std::list<std::pair<std::string, directory_ptr> > directory_list;
+
 	m7z_file_impl(const m7z_file_impl &) = delete;
 	m7z_file_impl(m7z_file_impl &&) = delete;
 	m7z_file_impl &operator=(const m7z_file_impl &) = delete;
@@ -163,10 +237,20 @@ private:
 			bool matchname,
 			bool partialpath);
 	void make_utf8_name(int index);
+	archive_file::error open_database();
+	void build_directory(m7z_directory &directory);
+	archive_file::error decompress_error(SRes res) const;
+
+	// member list cache
+	static directory_ptr find_directory(const std::string &filename, std::uint64_t length, const start_header &header);
+	static void add_directory(const std::string &filename, directory_ptr &&directory);
 
 	static constexpr std::size_t        CACHE_SIZE = 8;
+	static constexpr std::size_t        DIRECTORY_CACHE_SIZE = 4096; // number of member lists to keep
 	static std::array<ptr, CACHE_SIZE>  s_cache;
 	static std::mutex                   s_cache_mutex;
+	static directory_list               s_directory_lru;
+	static std::unordered_map<std::string, directory_list::iterator> s_directory_map;
 
 	const std::string           m_filename;             // copy of _7Z filename (for caching)
 
@@ -179,19 +263,18 @@ private:
 	std::vector<UInt16>         m_utf16_buf;
 	std::vector<unicode_char>   m_uchar_buf;
 	std::vector<char>           m_utf8_buf;
+	directory_ptr               m_directory;            // member list
 
 	CFileInStream               m_archive_stream;
 	CLookToRead                 m_look_stream;
 	CSzArEx                     m_db;
 	ISzAlloc                    m_alloc_imp;
 	ISzAlloc                    m_alloc_temp_imp;
-	bool                        m_inited;
+	bool                        m_inited;               // archive header has been read into m_db
 
-	// cached stuff for solid blocks
+	// most recently used solid block
 	UInt32                      m_block_index;
-	Byte *                      m_out_buffer;
-	std::size_t                 m_out_buffer_size;
-
+	solid_block_cache::block_ptr m_block;
 };
 
 
@@ -236,6 +319,14 @@ private:
 
 std::array<m7z_file_impl::ptr, m7z_file_impl::CACHE_SIZE> m7z_file_impl::s_cache;
 std::mutex m7z_file_impl::s_cache_mutex;
+m7z_file_impl::directory_list m7z_file_impl::s_directory_lru;
+std::unordered_map<std::string, m7z_file_impl::directory_list::iterator> m7z_file_impl::s_directory_map;
+
+std::mutex solid_block_cache::s_mutex;
+std::condition_variable solid_block_cache::s_ready;
+solid_block_cache::block_list solid_block_cache::s_lru;
+std::unordered_map<std::string, solid_block_cache::block_list::iterator> solid_block_cache::s_map;
+std::size_t solid_block_cache::s_bytes = 0;
 
 
 
@@ -281,10 +372,10 @@ m7z_file_impl::m7z_file_impl(const std::string &filename)
 	, m_utf16_buf(128)
 	, m_uchar_buf(128)
 	, m_utf8_buf(512)
+	, m_directory()
 	, m_inited(false)
-	, m_block_index(0)
-	, m_out_buffer(nullptr)
-	, m_out_buffer_size(0)
+	, m_block_index(~UInt32(0))
+	, m_block()
 {
 	m_alloc_imp.Alloc = &SzAlloc;
 	m_alloc_imp.Free = &SzFree;
@@ -306,14 +397,56 @@ archive_file::error m7z_file_impl::initialize()
 
 	osd_printf_verbose("un7z: opened archive file %s\n", m_filename.c_str());
 
+	// if we've already listed the members of this archive, share them
+	start_header header;
+	std::uint32_t read_length(0);
+	if ((m_archive_stream.osdfile->read(&header[0], 0, header.size(), read_length) == osd_file::error::NONE) && (read_length == header.size()))
+	{
+		m_directory = find_directory(m_filename, m_archive_stream.length, header);
+		if (m_directory)
+		{
+			osd_printf_verbose("un7z: found %s member list in cache\n", m_filename.c_str());
+			return archive_file::error::NONE;
+		}
+	}
+
+	archive_file::error const dberr = open_database();
+	if (dberr != archive_file::error::NONE)
+		return dberr;
+
+	// list and index the members, then make them available to future opens
+	auto directory = std::make_shared<m7z_directory>();
+	directory->length = m_archive_stream.length;
+	directory->header = header;
+	build_directory(*directory);
+	m_directory = directory;
+	if (read_length == header.size())
+		add_directory(m_filename, std::move(directory));
+
+	return archive_file::error::NONE;
+}
+
+
+/*-------------------------------------------------
+    open_database - read the archive header, which
+    is only needed for decompression once the
+    member list is known
+-------------------------------------------------*/
+
+archive_file::error m7z_file_impl::open_database()
+{
 	CrcGenerateTable(); // FIXME: doesn't belong here - it should be called once statically
 
+	m_archive_stream.currfpos = 0;
+	LookToRead_Init(&m_look_stream);
 	SzArEx_Init(&m_db);
 	m_inited = true;
 	SRes const res = SzArEx_Open(&m_db, &m_look_stream.s, &m_alloc_imp, &m_alloc_temp_imp);
 	if (res != SZ_OK)
 	{
 		osd_printf_error("un7z: error opening %s as 7z archive (%d)\n", m_filename.c_str(), int(res));
+		SzArEx_Free(&m_db, &m_alloc_imp);
+		m_inited = false;
 		switch (res)
 		{
 		case SZ_ERROR_UNSUPPORTED:  return archive_file::error::UNSUPPORTED;
@@ -327,6 +460,88 @@ archive_file::error m7z_file_impl::initialize()
 }
 
 
+/*-------------------------------------------------
+    build_directory - convert every file name once
+    and index the files by CRC and name
+-------------------------------------------------*/
+
+void m7z_file_impl::build_directory(m7z_directory &directory)
+{
+	directory.entries.reserve(m_db.NumFiles);
+	for (int i = 0; i < m_db.NumFiles; i++)
+	{
+		make_utf8_name(i);
+		m7z_directory::entry entry;
+		entry.name = &m_utf8_buf[0];
+		entry.is_dir = SzArEx_IsDir(&m_db, i);
+		entry.length = SzArEx_GetFileSize(&m_db, i);
+		entry.crc = m_db.CRCs.Vals[i];
+
+		// directories never match searches by CRC or name
+		if (!entry.is_dir)
+			directory.index.add(i, entry.name, SzBitArray_Check(m_db.CRCs.Defs, i), entry.crc);
+		directory.entries.emplace_back(std::move(entry));
+	}
+}
+
+
+/*-------------------------------------------------
+    find_directory - look for a member list that
+    is still valid for the file
+-------------------------------------------------*/
+
+m7z_file_impl::directory_ptr m7z_file_impl::find_directory(const std::string &filename, std::uint64_t length, const start_header &header)
+{
+	std::lock_guard<std::mutex> guard(s_cache_mutex);
+	auto const found(s_directory_map.find(filename));
+	if (found == s_directory_map.end())
+		return directory_ptr();
+
+	// if the file has changed underneath us, throw away the stale copy
+	directory_ptr const &directory(found->second->second);
+	if ((directory->length != length) || (directory->header != header))
+	{
+		osd_printf_verbose("un7z: %s changed since its member list was cached\n", filename.c_str());
+		s_directory_lru.erase(found->second);
+		s_directory_map.erase(found);
+		return directory_ptr();
+	}
+
+	// move it to the front of the list
+	s_directory_lru.splice(s_directory_lru.begin(), s_directory_lru, found->second);
+	return directory;
+}
+
+
+/*-------------------------------------------------
+    add_directory - remember a member list,
+    dropping the least recently used one if there
+    are too many
+-------------------------------------------------*/
+
+void m7z_file_impl::add_directory(const std::string &filename, directory_ptr &&directory)
+{
+	std::lock_guard<std::mutex> guard(s_cache_mutex);
+
+	// another thread may have beaten us to it
+	auto const found(s_directory_map.find(filename));
+	if (found != s_directory_map.end())
+	{
+		s_directory_lru.erase(found->second);
+		s_directory_map.erase(found);
+	}
+
+	if (s_directory_lru.size() >= DIRECTORY_CACHE_SIZE)
+	{
+		s_directory_map.erase(s_directory_lru.back().first);
+		s_directory_lru.pop_back();
+	}
+
+	s_directory_lru.emplace_front(filename, std::move(directory));
+	s_directory_map.emplace(filename, s_directory_lru.begin());
+}
+
+
 /*-------------------------------------------------
     _7z_file_close - close a _7Z file and add it
     to the cache
@@ -363,6 +578,117 @@ void m7z_file_impl::close(ptr &&archive)
 
 
 
+/***************************************************************************
+    SOLID BLOCK CACHE
+***************************************************************************/
+
+solid_block_cache::block_ptr solid_block_cache::acquire(const std::string &key, bool &claimed)
+{
+	std::unique_lock<std::mutex> lock(s_mutex);
+	auto const found(s_map.find(key));
+	if (found != s_map.end())
+	{
+		// wait for whoever is decoding it
+		block_ptr const block(found->second->second);
+		s_lru.splice(s_lru.begin(), s_lru, found->second);
+		s_ready.wait(lock, [&block] () { return block->ready; });
+		claimed = false;
+		return block;
+	}
+
+	// nobody has it - the caller must decode it
+	block_ptr const block(std::make_shared<solid_block>());
+	s_lru.emplace_front(key, block);
+	s_map.emplace(key, s_lru.begin());
+	claimed = true;
+	return block;
+}
+
+
+void solid_block_cache::complete(const std::string &key, const block_ptr &block, SRes result)
+{
+	std::lock_guard<std::mutex> lock(s_mutex);
+	block->result = result;
+	block->ready = true;
+	s_ready.notify_all();
+
+	// failures aren't worth remembering
+	auto const found(s_map.find(key));
+	if ((found != s_map.end()) && (found->second->second == block))
+	{
+		if (SZ_OK != result)
+		{
+			s_lru.erase(found->second);
+			s_map.erase(found);
+		}
+		else
+		{
+			s_bytes += block->data.size();
+			trim();
+		}
+	}
+}
+
+
+void solid_block_cache::release(const std::string &filename)
+{
+	std::lock_guard<std::mutex> lock(s_mutex);
+	for (auto it = s_lru.begin(); it != s_lru.end(); )
+	{
+		// blocks still being decoded are left for their decoder to complete
+		if (it->second->ready && (it->first.length() > filename.length()) && (it->first[filename.length()] == '|') && !it->first.compare(0, filename.length(), filename))
+		{
+			osd_printf_verbose("un7z: dropping solid block %s from cache\n", it->first.c_str());
+			s_bytes -= it->second->data.size();
+			s_map.erase(it->first);
+			it = s_lru.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+}
+
+
+void solid_block_cache::clear()
+{
+	std::lock_guard<std::mutex> lock(s_mutex);
+	for (auto it = s_lru.begin(); it != s_lru.end(); )
+	{
+		// blocks still being decoded are left for their decoder to complete
+		if (it->second->ready)
+		{
+			s_map.erase(it->first);
+			it = s_lru.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+	s_bytes = 0;
+}
+
+
+void solid_block_cache::trim()
+{
+	// drop least recently used decoded blocks, but always keep the newest
+	auto it(s_lru.end());
+	while ((s_bytes > MAX_CACHED_BYTES) && (it != s_lru.begin()) && (--it != s_lru.begin()))
+	{
+		if (it->second->ready)
+		{
+			osd_printf_verbose("un7z: dropping solid block %s from cache\n", it->first.c_str());
+			s_bytes -= it->second->data.size();
+			s_map.erase(it->first);
+			it = s_lru.erase(it);
+		}
+	}
+}
+
+
+
 /***************************************************************************
     7Z FILE ACCESS
 ***************************************************************************/
@@ -394,31 +720,74 @@ archive_file::error m7z_file_impl::decompress(void *buffer, std::uint32_t length
 		osd_printf_verbose("un7z: reopened archive file %s\n", m_filename.c_str());
 	}
 
-	std::size_t offset(0);
-	std::size_t out_size_processed(0);
-	SRes const res = SzArEx_Extract(
-			&m_db, &m_look_stream.s, m_curr_file_idx,           // requested file
-			&m_block_index, &m_out_buffer, &m_out_buffer_size,  // solid block caching
-			&offset, &out_size_processed,                       // data size/offset
-			&m_alloc_imp, &m_alloc_temp_imp);                   // allocator helpers
-	if (res != SZ_OK)
+	// the member list may have come from the cache without reading the archive header
+	if (!m_inited)
 	{
-		osd_printf_error("un7z: error decompressing %s from %s (%d)\n", m_curr_name.c_str(), m_filename.c_str(), int(res));
-		switch (res)
+		archive_file::error const err = open_database();
+		if (err != archive_file::error::NONE)
+			return err;
+	}
+
+	// empty files don't belong to a solid block
+	UInt32 const folder_index(m_db.FileToFolder[m_curr_file_idx]);
+	if (folder_index == ~UInt32(0))
+		return archive_file::error::NONE;
+
+	// get the decoded solid block, decoding it if nobody else has
+	if (!m_block || (m_block_index != folder_index))
+	{
+		m_block.reset();
+		std::string const key(m_filename + '|' + std::to_string(m_archive_stream.length) + '|' + std::to_string(folder_index));
+		bool claimed(false);
+		solid_block_cache::block_ptr block(solid_block_cache::acquire(key, claimed));
+		if (claimed)
 		{
-		case SZ_ERROR_UNSUPPORTED:  return archive_file::error::UNSUPPORTED;
-		case SZ_ERROR_MEM:          return archive_file::error::OUT_OF_MEMORY;
-		case SZ_ERROR_INPUT_EOF:    return archive_file::error::FILE_TRUNCATED;
-		default:                    return archive_file::error::DECOMPRESS_ERROR;
+			SRes res(SZ_OK);
+			UInt64 const unpack_size(SzAr_GetFolderUnpackSize(&m_db.db, folder_index));
+			try { block->data.resize(std::size_t(unpack_size)); }
+			catch (...) { res = SZ_ERROR_MEM; }
+			if ((SZ_OK == res) && (std::size_t(unpack_size) != unpack_size))
+				res = SZ_ERROR_MEM;
+			if ((SZ_OK == res) && unpack_size)
+				res = SzAr_DecodeFolder(&m_db.db, folder_index, &m_look_stream.s, m_db.dataPos, &block->data[0], std::size_t(unpack_size), &m_alloc_temp_imp);
+			solid_block_cache::complete(key, block, res);
 		}
+		if (block->result != SZ_OK)
+			return decompress_error(block->result);
+		m_block_index = folder_index;
+		m_block = std::move(block);
 	}
 
+	// locate the file within the block and check it
+	UInt64 const unpack_pos(m_db.UnpackPositions[m_curr_file_idx]);
+	std::size_t const offset(std::size_t(unpack_pos - m_db.UnpackPositions[m_db.FolderToFile[folder_index]]));
+	std::size_t const out_size_processed(std::size_t(m_db.UnpackPositions[m_curr_file_idx + 1] - unpack_pos));
+	if ((offset + out_size_processed) > m_block->data.size())
+		return decompress_error(SZ_ERROR_FAIL);
+	Byte const *const data(m_block->data.empty() ? nullptr : &m_block->data[offset]);
+	if (SzBitWithVals_Check(&m_db.CRCs, m_curr_file_idx) && (CrcCalc(data, out_size_processed) != m_db.CRCs.Vals[m_curr_file_idx]))
+		return decompress_error(SZ_ERROR_CRC);
+
 	// copy to destination buffer
-	std::memcpy(buffer, m_out_buffer + offset, (std::min<std::size_t>)(length, out_size_processed));
+	if (out_size_processed)
+		std::memcpy(buffer, data, (std::min<std::size_t>)(length, out_size_processed));
 	return archive_file::error::NONE;
 }
 
 
+archive_file::error m7z_file_impl::decompress_error(SRes res) const
+{
+	osd_printf_error("un7z: error decompressing %s from %s (%d)\n", m_curr_name.c_str(), m_filename.c_str(), int(res));
+	switch (res)
+	{
+	case SZ_ERROR_UNSUPPORTED:  return archive_file::error::UNSUPPORTED;
+	case SZ_ERROR_MEM:          return archive_file::error::OUT_OF_MEMORY;
+	case SZ_ERROR_INPUT_EOF:    return archive_file::error::FILE_TRUNCATED;
+	default:                    return archive_file::error::DECOMPRESS_ERROR;
+	}
+}
+
+
 int m7z_file_impl::search(
 		int i,
 		std::uint32_t search_crc,
@@ -427,33 +796,21 @@ int m7z_file_impl::search(
 		bool matchname,
 		bool partialpath)
 {
-	for ( ; i < m_db.NumFiles; i++)
-	{
-		make_utf8_name(i);
-		bool const is_dir(SzArEx_IsDir(&m_db, i));
-		const std::uint64_t size(SzArEx_GetFileSize(&m_db, i));
-		const std::uint32_t crc(m_db.CRCs.Vals[i]);
-		const bool crcmatch(SzBitArray_Check(m_db.CRCs.Defs, i) && (crc == search_crc));
-		auto const partialoffset(m_utf8_buf.size() - 1 - search_filename.length());
-		bool const partialpossible((m_utf8_buf.size() > (search_filename.length() + 1)) && (m_utf8_buf[partialoffset - 1] == '/'));
-		const bool namematch(
-				!core_stricmp(search_filename.c_str(), &m_utf8_buf[0]) ||
-				(partialpath && partialpossible && !core_stricmp(search_filename.c_str(), &m_utf8_buf[partialoffset])));
-
-		const bool found = ((!matchcrc && !matchname) || !is_dir) && (!matchcrc || crcmatch) && (!matchname || namematch);
-		if (found)
-		{
-			m_curr_file_idx = i;
-			m_curr_is_dir = is_dir;
-			m_curr_name = &m_utf8_buf[0];
-			m_curr_length = size;
-			m_curr_crc = crc;
+	// searches by CRC or name always start from the beginning, so the index gives the answer directly
+	if (matchcrc || matchname)
+		i = m_directory->index.find(search_crc, search_filename, matchcrc, matchname, partialpath);
 
-			return i;
-		}
-	}
+	if ((i < 0) || (i >= int(m_directory->entries.size())))
+		return -1;
+
+	m7z_directory::entry const &entry(m_directory->entries[i]);
+	m_curr_file_idx = i;
+	m_curr_is_dir = entry.is_dir;
+	m_curr_name = entry.name;
+	m_curr_length = entry.length;
+	m_curr_crc = entry.crc;
 
-	return -1;
+	return i;
 }
 
 
@@ -541,6 +898,7 @@ void m7z_file_cache_clear()
 {
 	// This is a trampoline called from unzip.cpp to avoid the need to have the zip and 7zip code in one file
 	m7z_file_impl::cache_clear();
+	solid_block_cache::clear();
 }
 
 } // namespace util
@@ -10,6 +10,7 @@
 
 #include "unzip.h"
 
+#include "arcindex.h"
 #include "corestr.h"
 #include "hashing.h"
 #include "osdcore.h"
@@ -19,7 +20,9 @@
 #include <cassert>
 #include <cstring>
 #include <cstdlib>
+#include <list>
 #include <mutex>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -44,7 +47,7 @@ public:
 		, m_file()
 		, m_length(0)
 		, m_ecd()
-		, m_cd()
+		, m_directory()
 		, m_cd_pos(0)
 		, m_header()
 		, m_curr_is_dir(false)
@@ -75,6 +78,8 @@ public:
 		// clear call cache entries
 		std::lock_guard<std::mutex> guard(s_cache_mutex);
 		for (std::size_t cachenum = 0; cachenum < s_cache.size(); s_cache[cachenum++].reset()) { }
+		s_directory_lru.clear();
+		s_directory_map.clear();
 	}
 
 	archive_file::error initialize()
@@ -101,8 +106,17 @@ public:
 			return archive_file::error::UNSUPPORTED;
 		}
 
+		// if we've already parsed this central directory, share it
+		m_directory = find_directory(m_filename, m_length, m_ecd);
+		if (m_directory)
+		{
+			osd_printf_verbose("unzip: found %s central directory in cache\n", m_filename.c_str());
+			return archive_file::error::NONE;
+		}
+
 		// allocate memory for the central directory
-		try { m_cd.resize(std::size_t(m_ecd.cd_size)); }
+		std::vector<std::uint8_t> cd;
+		try { cd.resize(std::size_t(m_ecd.cd_size)); }
 		catch (...)
 		{
 			osd_printf_error("unzip: %s failed to allocate memory for central directory\n", m_filename.c_str());
@@ -116,7 +130,7 @@ public:
 		{
 			std::uint32_t const chunk(std::uint32_t((std::min<std::uint64_t>)(std::numeric_limits<std::uint32_t>::max(), cd_remaining)));
 			std::uint32_t read_length(0);
-			auto const filerr = m_file->read(&m_cd[cd_offs], m_ecd.cd_start_disk_offset + cd_offs, chunk, read_length);
+			auto const filerr = m_file->read(&cd[cd_offs], m_ecd.cd_start_disk_offset + cd_offs, chunk, read_length);
 			if (filerr != osd_file::error::NONE)
 			{
 				osd_printf_error("unzip: %s error reading central directory (%d)\n", m_filename.c_str(), int(filerr));
@@ -132,6 +146,14 @@ public:
 		}
 		osd_printf_verbose("unzip: read %s central directory\n", m_filename.c_str());
 
+		// parse and index it, then make it available to future opens
+		auto directory = std::make_shared<zip_directory>();
+		directory->length = m_length;
+		directory->ecd_info = m_ecd;
+		parse_directory(cd, m_ecd.cd_size, *directory);
+		m_directory = directory;
+		add_directory(m_filename, std::move(directory));
+
 		return archive_file::error::NONE;
 	}
 
@@ -216,6 +238,7 @@ private:
 		std::uint32_t   start_disk_number;      // disk number start
 		std::uint64_t   local_header_offset;    // relative offset of local header
 		std::string     file_name;              // file name
+		bool            is_dir;                 // entry is a directory
 	};
 
 	// contains extracted end of central directory information
@@ -227,12 +250,41 @@ private:
 		std::uint64_t   cd_total_entries;       // total number of entries in the central directory
 		std::uint64_t   cd_size;                // size of the central directory
 		std::uint64_t   cd_start_disk_offset;   // offset of start of central directory with respect to the starting disk number
+
+		bool operator==(const ecd &that) const
+		{
+			return (disk_number == that.disk_number) &&
+					(cd_start_disk_number == that.cd_start_disk_number) &&
+					(cd_disk_entries == that.cd_disk_entries) &&
+					(cd_total_entries == that.cd_total_entries) &&
+					(cd_size == that.cd_size) &&
+					(cd_start_disk_offset == that.cd_start_disk_offset);
+		}
 	};
 
+	// parsed central directory, shared between every open of the same archive
+	struct zip_directory
+	{
+		std::uint64_t               length;             // length of zip file it was read from
+		ecd                         ecd_info;           // end of central directory it was read from
+		std::vector<file_header>    entries;            // central directory entries in order
+		archive_index               index;              // lookup by CRC and name
+	};
+	typedef std::shared_ptr<zip_directory const> directory_ptr;
+	typedef std::list<std::pair<std::string, directory_ptr> > directory_list;
+
+	// central directory cache
+	static directory_ptr find_directory(const std::string &filename, std::uint64_t length, const ecd &ecd_info);
+	static void add_directory(const std::string &filename, directory_ptr &&directory);
+	static void parse_directory(const std::vector<std::uint8_t> &cd, std::uint64_t cd_size, zip_directory &directory);
+
 	static constexpr std::size_t        DECOMPRESS_BUFSIZE = 16384;
 	static constexpr std::size_t        CACHE_SIZE = 8; // number of open files to cache
+	static constexpr std::size_t        DIRECTORY_CACHE_SIZE = 4096; // number of parsed central directories to keep
 	static std::array<ptr, CACHE_SIZE>  s_cache;
 	static std::mutex                   s_cache_mutex;
+	static directory_list               s_directory_lru;
+	static std::unordered_map<std::string, directory_list::iterator> s_directory_map;
 
 	const std::string           m_filename;                 // copy of ZIP filename (for caching)
 	osd_file::ptr               m_file;                     // OSD file handle
@@ -240,8 +292,8 @@ private:
 
 	ecd                         m_ecd;                      // end of central directory
 
-	std::vector<std::uint8_t>   m_cd;                       // central directory raw data
-	std::uint32_t               m_cd_pos;                   // position in central directory
+	directory_ptr               m_directory;                // parsed central directory
+	std::size_t                 m_cd_pos;                   // index of next central directory entry
 	file_header                 m_header;                   // current file header
 	bool                        m_curr_is_dir;              // current file is directory
 
@@ -569,6 +621,8 @@ private:
 /** @brief  The zip cache[ zip cache size]. */
 std::array<zip_file_impl::ptr, zip_file_impl::CACHE_SIZE> zip_file_impl::s_cache;
 std::mutex zip_file_impl::s_cache_mutex;
+zip_file_impl::directory_list zip_file_impl::s_directory_lru;
+std::unordered_map<std::string, zip_file_impl::directory_list::iterator> zip_file_impl::s_directory_map;
 
 
 
@@ -618,31 +672,65 @@ void zip_file_impl::close(ptr &&zip)
 
 int zip_file_impl::search(std::uint32_t search_crc, const std::string &search_filename, bool matchcrc, bool matchname, bool partialpath)
 {
+	auto const &entries(m_directory->entries);
+
+	// searches by CRC or name always start from the beginning, so the index gives the answer directly
+	if (matchcrc || matchname)
+	{
+		int const found(m_directory->index.find(search_crc, search_filename, matchcrc, matchname, partialpath));
+		if (found < 0)
+		{
+			m_cd_pos = entries.size();
+			return -1;
+		}
+		m_cd_pos = std::size_t(found);
+	}
+
+	// if we're at or past the end, we're done
+	if (m_cd_pos >= entries.size())
+		return -1;
+
+	m_header = entries[m_cd_pos++];
+	m_curr_is_dir = m_header.is_dir;
+	return 0;
+}
+
+
+/*-------------------------------------------------
+    parse_directory - extract every entry from
+    the raw central directory and index them
+-------------------------------------------------*/
+
+void zip_file_impl::parse_directory(const std::vector<std::uint8_t> &cd, std::uint64_t cd_size, zip_directory &directory)
+{
+	std::size_t cd_pos(0);
+	file_header header;
+
 	// if we're at or past the end, we're done
-	while ((m_cd_pos + central_dir_entry_reader::minimum_length()) <= m_ecd.cd_size)
+	while ((cd_pos + central_dir_entry_reader::minimum_length()) <= cd_size)
 	{
 		// make sure we have enough data
-		central_dir_entry_reader const reader(&m_cd[0] + m_cd_pos);
-		if (!reader.signature_correct() || ((m_cd_pos + reader.total_length()) > m_ecd.cd_size))
+		central_dir_entry_reader const reader(&cd[0] + cd_pos);
+		if (!reader.signature_correct() || ((cd_pos + reader.total_length()) > cd_size))
 			break;
 
 		// extract file header info
-		m_header.version_created     = reader.version_created();
-		m_header.version_needed      = reader.version_needed();
-		m_header.bit_flag            = reader.general_flag();
-		m_header.compression         = reader.compression_method();
-		m_header.crc                 = reader.crc32();
-		m_header.compressed_length   = reader.compressed_size();
-		m_header.uncompressed_length = reader.uncompressed_size();
-		m_header.start_disk_number   = reader.start_disk();
-		m_header.local_header_offset = reader.header_offset();
+		header.version_created     = reader.version_created();
+		header.version_needed      = reader.version_needed();
+		header.bit_flag            = reader.general_flag();
+		header.compression         = reader.compression_method();
+		header.crc                 = reader.crc32();
+		header.compressed_length   = reader.compressed_size();
+		header.uncompressed_length = reader.uncompressed_size();
+		header.start_disk_number   = reader.start_disk();
+		header.local_header_offset = reader.header_offset();
 
 		// advance the position
-		m_cd_pos += reader.total_length();
+		cd_pos += reader.total_length();
 
 		// copy the filename
-		bool is_utf8(general_flag_reader(m_header.bit_flag).utf8_encoding());
-		reader.file_name(m_header.file_name);
+		bool is_utf8(general_flag_reader(header.bit_flag).utf8_encoding());
+		reader.file_name(header.file_name);
 
 		// walk the extra data
 		for (auto extra = reader.extra_field(); extra.length_sufficient(); extra = extra.next())
@@ -653,10 +741,10 @@ int zip_file_impl::search(std::uint32_t search_crc, const std::string &search_fi
 				zip64_ext_info_reader const ext64(reader, extra);
 				if (extra.data_size() >= ext64.total_length())
 				{
-					m_header.compressed_length   = ext64.compressed_size();
-					m_header.uncompressed_length = ext64.uncompressed_size();
-					m_header.start_disk_number   = ext64.start_disk();
-					m_header.local_header_offset = ext64.header_offset();
+					header.compressed_length   = ext64.compressed_size();
+					header.uncompressed_length = ext64.uncompressed_size();
+					header.start_disk_number   = ext64.start_disk();
+					header.local_header_offset = ext64.header_offset();
 				}
 			}
 
@@ -666,12 +754,12 @@ int zip_file_impl::search(std::uint32_t search_crc, const std::string &search_fi
 				utf8_path_reader const utf8path(extra);
 				if (utf8path.version() == 1)
 				{
-					auto const addr(m_header.file_name.empty() ? nullptr : &m_header.file_name[0]);
-					auto const length(m_header.file_name.empty() ? 0 : m_header.file_name.length() * sizeof(m_header.file_name[0]));
+					auto const addr(header.file_name.empty() ? nullptr : &header.file_name[0]);
+					auto const length(header.file_name.empty() ? 0 : header.file_name.length() * sizeof(header.file_name[0]));
 					auto const crc(crc32_creator::simple(addr, length));
 					if (utf8path.name_crc32() == crc.m_raw)
 					{
-						utf8path.unicode_name(m_header.file_name);
+						utf8path.unicode_name(header.file_name);
 						is_utf8 = true;
 					}
 				}
@@ -681,25 +769,71 @@ int zip_file_impl::search(std::uint32_t search_crc, const std::string &search_fi
 		// FIXME: if (!is_utf8) convert filename to UTF8 (assume CP437 or something)
 
 		// chop off trailing slash for directory entries
-		bool const is_dir(!m_header.file_name.empty() && (m_header.file_name.back() == '/'));
-		if (is_dir) m_header.file_name.resize(m_header.file_name.length() - 1);
-
-		// check to see if it matches query
-		bool const crcmatch(search_crc == m_header.crc);
-		auto const partialoffset(m_header.file_name.length() - search_filename.length());
-		bool const partialpossible((m_header.file_name.length() > search_filename.length()) && (m_header.file_name[partialoffset - 1] == '/'));
-		const bool namematch(
-				!core_stricmp(search_filename.c_str(), m_header.file_name.c_str()) ||
-				(partialpath && partialpossible && !core_stricmp(search_filename.c_str(), m_header.file_name.c_str() + partialoffset)));
-
-		bool const found = ((!matchcrc && !matchname) || !is_dir) && (!matchcrc || crcmatch) && (!matchname || namematch);
-		if (found)
-		{
-			m_curr_is_dir = is_dir;
-			return 0;
-		}
+		header.is_dir = !header.file_name.empty() && (header.file_name.back() == '/');
+		if (header.is_dir) header.file_name.resize(header.file_name.length() - 1);
+
+		// directories never match searches by CRC or name
+		if (!header.is_dir)
+			directory.index.add(directory.entries.size(), header.file_name, true, header.crc);
+		directory.entries.push_back(header);
 	}
-	return -1;
+}
+
+
+/*-------------------------------------------------
+    find_directory - look for a parsed central
+    directory that is still valid for the file
+-------------------------------------------------*/
+
+zip_file_impl::directory_ptr zip_file_impl::find_directory(const std::string &filename, std::uint64_t length, const ecd &ecd_info)
+{
+	std::lock_guard<std::mutex> guard(s_cache_mutex);
+	auto const found(s_directory_map.find(filename));
+	if (found == s_directory_map.end())
+		return directory_ptr();
+
+	// if the file has changed underneath us, throw away the stale copy
+	directory_ptr const &directory(found->second->second);
+	if ((directory->length != length) || !(directory->ecd_info == ecd_info))
+	{
+		osd_printf_verbose("unzip: %s changed since its central directory was cached\n", filename.c_str());
+		s_directory_lru.erase(found->second);
+		s_directory_map.erase(found);
+		return directory_ptr();
+	}
+
+	// move it to the front of the list
+	s_directory_lru.splice(s_directory_lru.begin(), s_directory_lru, found->second);
+	return directory;
+}
+
+
+/*-------------------------------------------------
+    add_directory - remember a parsed central
+    directory, dropping the least recently used
+    one if there are too many
+-------------------------------------------------*/
+
+void zip_file_impl::add_directory(const std::string &filename, directory_ptr &&directory)
+{
+	std::lock_guard<std::mutex> guard(s_cache_mutex);
+
+	// another thread may have beaten us to it
+	auto const found(s_directory_map.find(filename));
+	if (found != s_directory_map.end())
+	{
+		s_directory_lru.erase(found->second);
+		s_directory_map.erase(found);
+	}
+
+	if (s_directory_lru.size() >= DIRECTORY_CACHE_SIZE)
+	{
+		s_directory_map.erase(s_directory_lru.back().first);
+		s_directory_lru.pop_back();
+	}
+
+	s_directory_lru.emplace_front(filename, std::move(directory));
+	s_directory_map.emplace(filename, s_directory_lru.begin());
 }
 
 
@@ -111,9 +111,39 @@ public:
 		int       local_y;
 	}m_vdp1;
 
+	struct stv_vdp2_roz_job
+	{
+		saturn_state *state;
+		bitmap_rgb32 *bitmap;
+		bitmap_rgb32 *roz_bitmap;
+		int     min_x, max_x;
+		UINT8   vcnt_shift, hcnt_shift;
+		INT32   planerenderedsizex, planerenderedsizey;
+		INT32   clipxmask, clipymask;
+		INT8    use_coeff_table, coeff_table_mode, coeff_table_size;
+		UINT32  *coeff_table_base;
+		UINT32  coeff_table_offset;
+		INT32   kx, ky, dx, dy, xp, yp;
+		UINT8   transparency;
+		UINT8   fade_control;
+		UINT8   alpha;
+	};
+
+	struct stv_vdp2_roz_band
+	{
+		stv_vdp2_roz_job *job;
+		int     min_y, max_y;
+		bool    done;
+	};
+
+	static const int STV_VDP2_ROZ_BANDS = 8;
+
 	struct {
 		std::unique_ptr<UINT8[]>      gfx_decode;
 		bitmap_rgb32 roz_bitmap[2];
+		osd_work_queue *roz_queue;
+		stv_vdp2_roz_job roz_job;
+		stv_vdp2_roz_band roz_band[STV_VDP2_ROZ_BANDS];
 		UINT8     dotsel;
 		UINT8     pal;
 		UINT16    h_count;
@@ -364,6 +394,10 @@ public:
 	void stv_vdp2_check_tilemap_with_linescroll(bitmap_rgb32 &bitmap, const rectangle &cliprect);
 	void stv_vdp2_check_tilemap(bitmap_rgb32 &bitmap, const rectangle &cliprect);
 	void stv_vdp2_copy_roz_bitmap(bitmap_rgb32 &bitmap, bitmap_rgb32 &roz_bitmap, const rectangle &cliprect, int iRP, int planesizex, int planesizey, int planerenderedsizex, int planerenderedsizey);
+	void stv_vdp2_copy_roz_lines(const stv_vdp2_roz_job &job, int min_y, int max_y);
+	static void *stv_vdp2_roz_band_callback(void *param, int threadid);
+	inline void stv_vdp2_roz_plot(const stv_vdp2_roz_job &job, UINT32 *dest, rgb_t pix);
+	inline bool stv_vdp2_roz_read_coeff(const stv_vdp2_roz_job &job, UINT32 kaddr, INT32 *coeff);
 	void stv_vdp2_fill_rotation_parameter_table( UINT8 rot_parameter );
 	UINT8 stv_vdp2_check_vram_cycle_pattern_registers( UINT8 access_command_pnmdr, UINT8 access_command_cpdr, UINT8 bitmap_enable );
 	UINT8 stv_vdp2_is_rotation_applied(void);
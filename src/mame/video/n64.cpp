@@ -2121,6 +2121,7 @@ void n64_rdp::draw_triangle(bool shade, bool texture, bool zbuffer, bool rect)
 
 				rdp_span_aux* userdata = (rdp_span_aux*)spans[spanidx].userdata;
 				userdata->m_tmem = object->m_tmem;
+				userdata->m_noise_seed = machine().rand();
 
 				userdata->m_blend_color = m_blend_color;
 				userdata->m_prim_color = m_prim_color;
@@ -3264,9 +3265,9 @@ void n64_rdp::render_spans(INT32 start, INT32 end, INT32 tilenum, bool flip, ext
 	wait("render spans");
 }
 
-void n64_rdp::rgbaz_clip(INT32 sr, INT32 sg, INT32 sb, INT32 sa, INT32* sz, rdp_span_aux* userdata)
+void n64_rdp::rgbaz_clip(const rgbaint_t& srgba, INT32* sz, rdp_span_aux* userdata)
 {
-	userdata->m_shade_color.set(sa, sr, sg, sb);
+	userdata->m_shade_color = srgba;
 	userdata->m_shade_color.clamp_and_clear(0xfffffe00);
 	UINT32 a = userdata->m_shade_color.get_a();
 	userdata->m_shade_alpha.set(a, a, a, a);
@@ -3283,38 +3284,46 @@ void n64_rdp::rgbaz_clip(INT32 sr, INT32 sg, INT32 sb, INT32 sa, INT32* sz, rdp_
 	}
 }
 
-void n64_rdp::rgbaz_correct_triangle(INT32 offx, INT32 offy, INT32* r, INT32* g, INT32* b, INT32* a, INT32* z, rdp_span_aux* userdata, const rdp_poly_state &object)
+void n64_rdp::rgbaz_correct_triangle(INT32 offx, INT32 offy, rgbaint_t& srgba, INT32* z, const rgbaint_t& drgbadx, const rgbaint_t& drgbady, rdp_span_aux* userdata, const rdp_poly_state &object)
 {
 	if (userdata->m_current_pix_cvg == 8)
 	{
-		*r >>= 2;
-		*g >>= 2;
-		*b >>= 2;
-		*a >>= 2;
+		srgba.sra_imm(2);
 		*z = (*z >> 3) & 0x7ffff;
 	}
 	else
 	{
-		INT32 summand_xr = offx * SIGN13(object.m_span_base.m_span_dr >> 14);
-		INT32 summand_yr = offy * SIGN13(object.m_span_base.m_span_drdy >> 14);
-		INT32 summand_xb = offx * SIGN13(object.m_span_base.m_span_db >> 14);
-		INT32 summand_yb = offy * SIGN13(object.m_span_base.m_span_dbdy >> 14);
-		INT32 summand_xg = offx * SIGN13(object.m_span_base.m_span_dg >> 14);
-		INT32 summand_yg = offy * SIGN13(object.m_span_base.m_span_dgdy >> 14);
-		INT32 summand_xa = offx * SIGN13(object.m_span_base.m_span_da >> 14);
-		INT32 summand_ya = offy * SIGN13(object.m_span_base.m_span_dady >> 14);
+		rgbaint_t summand_x(drgbadx);
+		rgbaint_t summand_y(drgbady);
+		summand_x.mul_imm(offx);
+		summand_y.mul_imm(offy);
 
 		INT32 summand_xz = offx * SIGN22(object.m_span_base.m_span_dz >> 10);
 		INT32 summand_yz = offy * SIGN22(object.m_span_base.m_span_dzdy >> 10);
 
-		*r = ((*r << 2) + summand_xr + summand_yr) >> 4;
-		*g = ((*g << 2) + summand_xg + summand_yg) >> 4;
-		*b = ((*b << 2) + summand_xb + summand_yb) >> 4;
-		*a = ((*a << 2) + summand_xa + summand_ya) >> 4;
+		srgba.shl_imm(2);
+		srgba.add(summand_x);
+		srgba.add(summand_y);
+		srgba.sra_imm(4);
 		*z = (((*z << 2) + summand_xz + summand_yz) >> 5) & 0x7ffff;
 	}
 }
 
+void n64_rdp::span_color_setup(const extent_t &extent, const rdp_poly_state &object, rgbaint_t& rgba, rgbaint_t& drgbainc, rgbaint_t& drgbadx, rgbaint_t& drgbady)
+{
+	rgba.set(extent.param[SPAN_A].start, extent.param[SPAN_R].start, extent.param[SPAN_G].start, extent.param[SPAN_B].start);
+	drgbainc.set(object.m_span_base.m_span_da, object.m_span_base.m_span_dr, object.m_span_base.m_span_dg, object.m_span_base.m_span_db);
+	if (!object.flip)
+	{
+		drgbainc.xor_imm(0xffffffff);
+		drgbainc.add_imm(1);
+	}
+
+	// per-pixel coverage correction terms, constant over the whole span
+	drgbadx.set(SIGN13(object.m_span_base.m_span_da >> 14), SIGN13(object.m_span_base.m_span_dr >> 14), SIGN13(object.m_span_base.m_span_dg >> 14), SIGN13(object.m_span_base.m_span_db >> 14));
+	drgbady.set(SIGN13(object.m_span_base.m_span_dady >> 14), SIGN13(object.m_span_base.m_span_drdy >> 14), SIGN13(object.m_span_base.m_span_dgdy >> 14), SIGN13(object.m_span_base.m_span_dbdy >> 14));
+}
+
 inline void n64_rdp::write_pixel(UINT32 curpixel, color_t& color, rdp_span_aux* userdata, const rdp_poly_state &object)
 {
 	if (object.m_misc_state.m_fb_size == 2) // 16-bit framebuffer
@@ -3500,10 +3509,8 @@ void n64_rdp::span_draw_1cycle(INT32 scanline, const extent_t &extent, const rdp
 	const INT32 tilenum = object.tilenum;
 	const bool flip = object.flip;
 
-	span_param_t r; r.w = extent.param[SPAN_R].start;
-	span_param_t g; g.w = extent.param[SPAN_G].start;
-	span_param_t b; b.w = extent.param[SPAN_B].start;
-	span_param_t a; a.w = extent.param[SPAN_A].start;
+	rgbaint_t rgba, drgbainc, drgbadx, drgbady;
+	span_color_setup(extent, object, rgba, drgbainc, drgbadx, drgbady);
 	span_param_t z; z.w = extent.param[SPAN_Z].start;
 	span_param_t s; s.w = extent.param[SPAN_S].start;
 	span_param_t t; t.w = extent.param[SPAN_T].start;
@@ -3524,17 +3531,12 @@ void n64_rdp::span_draw_1cycle(INT32 scanline, const extent_t &extent, const rdp
 	const bool partialreject = (userdata->m_color_inputs.blender2b_a[0] == &userdata->m_inv_pixel_color && userdata->m_color_inputs.blender1b_a[0] == &userdata->m_pixel_color);
 	const INT32 sel0 = (userdata->m_color_inputs.blender2b_a[0] == &userdata->m_memory_color) ? 1 : 0;
 
-	INT32 drinc, dginc, dbinc, dainc;
 	INT32 dzinc, dzpix;
 	INT32 dsinc, dtinc, dwinc;
 	INT32 xinc;
 
 	if (!flip)
 	{
-		drinc = -object.m_span_base.m_span_dr;
-		dginc = -object.m_span_base.m_span_dg;
-		dbinc = -object.m_span_base.m_span_db;
-		dainc = -object.m_span_base.m_span_da;
 		dzinc = -object.m_span_base.m_span_dz;
 		dsinc = -object.m_span_base.m_span_ds;
 		dtinc = -object.m_span_base.m_span_dt;
@@ -3543,10 +3545,6 @@ void n64_rdp::span_draw_1cycle(INT32 scanline, const extent_t &extent, const rdp
 	}
 	else
 	{
-		drinc = object.m_span_base.m_span_dr;
-		dginc = object.m_span_base.m_span_dg;
-		dbinc = object.m_span_base.m_span_db;
-		dainc = object.m_span_base.m_span_da;
 		dzinc = object.m_span_base.m_span_dz;
 		dsinc = object.m_span_base.m_span_ds;
 		dtinc = object.m_span_base.m_span_dt;
@@ -3596,10 +3594,8 @@ void n64_rdp::span_draw_1cycle(INT32 scanline, const extent_t &extent, const rdp
 	userdata->m_start_span = true;
 	for (INT32 j = 0; j <= length; j++)
 	{
-		INT32 sr = r.w >> 14;
-		INT32 sg = g.w >> 14;
-		INT32 sb = b.w >> 14;
-		INT32 sa = a.w >> 14;
+		rgbaint_t srgba(rgba);
+		srgba.sra_imm(14);
 		INT32 sz = (z.w >> 10) & 0x3fffff;
 		const bool valid_x = (flip) ? (x >= xend_scissored) : (x <= xend_scissored);
 
@@ -3610,14 +3606,14 @@ void n64_rdp::span_draw_1cycle(INT32 scanline, const extent_t &extent, const rdp
 
 			m_tex_pipe.lod_1cycle(&sss, &sst, s.w, t.w, w.w, dsinc, dtinc, dwinc, userdata, object);
 
-			rgbaz_correct_triangle(offx, offy, &sr, &sg, &sb, &sa, &sz, userdata, object);
-			rgbaz_clip(sr, sg, sb, sa, &sz, userdata);
+			rgbaz_correct_triangle(offx, offy, srgba, &sz, drgbadx, drgbady, userdata, object);
+			rgbaz_clip(srgba, &sz, userdata);
 
 			((m_tex_pipe).*(m_tex_pipe.m_cycle[cycle0]))(&userdata->m_texel0_color, &userdata->m_texel0_color, sss, sst, tilenum, 0, userdata, object);
 			UINT32 t0a = userdata->m_texel0_color.get_a();
 			userdata->m_texel0_alpha.set(t0a, t0a, t0a, t0a);
 
-			const UINT8 noise = rand() << 3; // Not accurate
+			const UINT8 noise = userdata->noise() << 3; // Not accurate
 			userdata->m_noise_color.set(0, noise, noise, noise);
 
 			rgbaint_t rgbsub_a(*userdata->m_color_inputs.combiner_rgbsub_a[1]);
@@ -3676,10 +3672,7 @@ void n64_rdp::span_draw_1cycle(INT32 scanline, const extent_t &extent, const rdp
 			sst = userdata->m_precomp_t;
 		}
 
-		r.w += drinc;
-		g.w += dginc;
-		b.w += dbinc;
-		a.w += dainc;
+		rgba.add(drgbainc);
 		s.w += dsinc;
 		t.w += dtinc;
 		w.w += dwinc;
@@ -3698,10 +3691,8 @@ void n64_rdp::span_draw_2cycle(INT32 scanline, const extent_t &extent, const rdp
 	const INT32 tilenum = object.tilenum;
 	const bool flip = object.flip;
 
-	span_param_t r; r.w = extent.param[SPAN_R].start;
-	span_param_t g; g.w = extent.param[SPAN_G].start;
-	span_param_t b; b.w = extent.param[SPAN_B].start;
-	span_param_t a; a.w = extent.param[SPAN_A].start;
+	rgbaint_t rgba, drgbainc, drgbadx, drgbady;
+	span_color_setup(extent, object, rgba, drgbainc, drgbadx, drgbady);
 	span_param_t z; z.w = extent.param[SPAN_Z].start;
 	span_param_t s; s.w = extent.param[SPAN_S].start;
 	span_param_t t; t.w = extent.param[SPAN_T].start;
@@ -3731,17 +3722,12 @@ void n64_rdp::span_draw_2cycle(INT32 scanline, const extent_t &extent, const rdp
 	INT32 sel0 = (userdata->m_color_inputs.blender2b_a[0] == &userdata->m_memory_color) ? 1 : 0;
 	INT32 sel1 = (userdata->m_color_inputs.blender2b_a[1] == &userdata->m_memory_color) ? 1 : 0;
 
-	INT32 drinc, dginc, dbinc, dainc;
 	INT32 dzinc, dzpix;
 	INT32 dsinc, dtinc, dwinc;
 	INT32 xinc;
 
 	if (!flip)
 	{
-		drinc = -object.m_span_base.m_span_dr;
-		dginc = -object.m_span_base.m_span_dg;
-		dbinc = -object.m_span_base.m_span_db;
-		dainc = -object.m_span_base.m_span_da;
 		dzinc = -object.m_span_base.m_span_dz;
 		dsinc = -object.m_span_base.m_span_ds;
 		dtinc = -object.m_span_base.m_span_dt;
@@ -3750,10 +3736,6 @@ void n64_rdp::span_draw_2cycle(INT32 scanline, const extent_t &extent, const rdp
 	}
 	else
 	{
-		drinc = object.m_span_base.m_span_dr;
-		dginc = object.m_span_base.m_span_dg;
-		dbinc = object.m_span_base.m_span_db;
-		dainc = object.m_span_base.m_span_da;
 		dzinc = object.m_span_base.m_span_dz;
 		dsinc = object.m_span_base.m_span_ds;
 		dtinc = object.m_span_base.m_span_dt;
@@ -3807,10 +3789,8 @@ void n64_rdp::span_draw_2cycle(INT32 scanline, const extent_t &extent, const rdp
 	userdata->m_start_span = true;
 	for (INT32 j = 0; j <= length; j++)
 	{
-		INT32 sr = r.w >> 14;
-		INT32 sg = g.w >> 14;
-		INT32 sb = b.w >> 14;
-		INT32 sa = a.w >> 14;
+		rgbaint_t srgba(rgba);
+		srgba.sra_imm(14);
 		INT32 sz = (z.w >> 10) & 0x3fffff;
 
 		const bool valid_x = (flip) ? (x >= xend_scissored) : (x <= xend_scissored);
@@ -3830,8 +3810,8 @@ void n64_rdp::span_draw_2cycle(INT32 scanline, const extent_t &extent, const rdp
 			newt = userdata->m_precomp_t;
 			m_tex_pipe.lod_2cycle_limited(&news, &newt, s.w + dsinc, t.w + dtinc, w.w + dwinc, dsinc, dtinc, dwinc, prim_tile, &newtile1, object);
 
-			rgbaz_correct_triangle(offx, offy, &sr, &sg, &sb, &sa, &sz, userdata, object);
-			rgbaz_clip(sr, sg, sb, sa, &sz, userdata);
+			rgbaz_correct_triangle(offx, offy, srgba, &sz, drgbadx, drgbady, userdata, object);
+			rgbaz_clip(srgba, &sz, userdata);
 
 			((m_tex_pipe).*(m_tex_pipe.m_cycle[cycle0]))(&userdata->m_texel0_color, &userdata->m_texel0_color, sss, sst, tile1, 0, userdata, object);
 			((m_tex_pipe).*(m_tex_pipe.m_cycle[cycle1]))(&userdata->m_texel1_color, &userdata->m_texel0_color, sss, sst, tile2, 1, userdata, object);
@@ -3844,7 +3824,7 @@ void n64_rdp::span_draw_2cycle(INT32 scanline, const extent_t &extent, const rdp
 			userdata->m_texel1_alpha.set(t1a, t1a, t1a, t1a);
 			userdata->m_next_texel_alpha.set(tna, tna, tna, tna);
 
-			const UINT8 noise = rand() << 3; // Not accurate
+			const UINT8 noise = userdata->noise() << 3; // Not accurate
 			userdata->m_noise_color.set(0, noise, noise, noise);
 
 			rgbaint_t rgbsub_a(*userdata->m_color_inputs.combiner_rgbsub_a[0]);
@@ -3932,10 +3912,7 @@ void n64_rdp::span_draw_2cycle(INT32 scanline, const extent_t &extent, const rdp
 			sst = userdata->m_precomp_t;
 		}
 
-		r.w += drinc;
-		g.w += dginc;
-		b.w += dbinc;
-		a.w += dainc;
+		rgba.add(drgbainc);
 		s.w += dsinc;
 		t.w += dtinc;
 		w.w += dwinc;
@@ -262,8 +262,9 @@ public:
 	void        cmd_set_mask_image(UINT32 w1, UINT32 w2);
 	void        cmd_set_color_image(UINT32 w1, UINT32 w2);
 
-	void        rgbaz_clip(INT32 sr, INT32 sg, INT32 sb, INT32 sa, INT32* sz, rdp_span_aux* userdata);
-	void        rgbaz_correct_triangle(INT32 offx, INT32 offy, INT32* r, INT32* g, INT32* b, INT32* a, INT32* z, rdp_span_aux* userdata, const rdp_poly_state &object);
+	void        rgbaz_clip(const rgbaint_t& srgba, INT32* sz, rdp_span_aux* userdata);
+	void        rgbaz_correct_triangle(INT32 offx, INT32 offy, rgbaint_t& srgba, INT32* z, const rgbaint_t& drgbadx, const rgbaint_t& drgbady, rdp_span_aux* userdata, const rdp_poly_state &object);
+	void        span_color_setup(const extent_t &extent, const rdp_poly_state &object, rgbaint_t& rgba, rgbaint_t& drgbainc, rgbaint_t& drgbadx, rgbaint_t& drgbady);
 
 	void        triangle(bool shade, bool texture, bool zbuffer);
 
@@ -306,6 +306,10 @@ struct rdp_span_aux
 	UINT8*              m_tmem;                /* pointer to texture cache for this polygon */
 	bool                m_start_span;
 	rgbaint_t           m_clamp_diff[8];
+	UINT32              m_noise_seed;          /* random state for noise and alpha dither, seeded at setup */
+
+	// spans are drawn by one thread at a time, so this needs no locking
+	UINT32 noise() { m_noise_seed = m_noise_seed * 1103515245 + 12345; return m_noise_seed >> 16; }
 };
 
 struct z_decompress_entry_t
@@ -2183,7 +2183,7 @@ void powervr2_device::computedilated()
 			dilatechose[(b << 3) + a]=3+(a < b ? a : b);
 }
 
-void powervr2_device::render_hline(bitmap_rgb32 &bitmap, texinfo *ti, int y, float xl, float xr, float ul, float ur, float vl, float vr, float wl, float wr)
+void powervr2_device::render_hline(bitmap_rgb32 &bitmap, const rectangle &clip, texinfo *ti, int y, float xl, float xr, float ul, float ur, float vl, float vr, float wl, float wr)
 {
 	int xxl, xxr;
 	float dx, ddx, dudx, dvdx, dwdx;
@@ -2193,7 +2193,7 @@ void powervr2_device::render_hline(bitmap_rgb32 &bitmap, texinfo *ti, int y, flo
 	// untextured cases aren't handled
 //  if (!ti->textured) return;
 
-	if(xr < 0 || xl >= 640)
+	if(xr < clip.min_x || xl >= clip.max_x + 1)
 		return;
 
 	xxl = round(xl);
@@ -2207,10 +2207,12 @@ void powervr2_device::render_hline(bitmap_rgb32 &bitmap, texinfo *ti, int y, flo
 	dvdx = (vr-vl)/dx;
 	dwdx = (wr-wl)/dx;
 
-	if(xxl < 0)
-		xxl = 0;
-	if(xxr > 640)
-		xxr = 640;
+	if(xxl < clip.min_x)
+		xxl = clip.min_x;
+	if(xxr > clip.max_x + 1)
+		xxr = clip.max_x + 1;
+	if(xxl >= xxr)
+		return;
 
 	// Target the pixel center
 	ddx = xxl + 0.5f - xl;
@@ -2257,7 +2259,7 @@ void powervr2_device::render_hline(bitmap_rgb32 &bitmap, texinfo *ti, int y, flo
 	}
 }
 
-void powervr2_device::render_span(bitmap_rgb32 &bitmap, texinfo *ti,
+void powervr2_device::render_span(bitmap_rgb32 &bitmap, const rectangle &clip, texinfo *ti,
 									float y0, float y1,
 									float xl, float xr,
 									float ul, float ur,
@@ -2271,21 +2273,22 @@ void powervr2_device::render_span(bitmap_rgb32 &bitmap, texinfo *ti,
 	float dy;
 	int yy0, yy1;
 
-	if(y1 <= 0)
+	if(y1 <= clip.min_y)
 		return;
-	if(y1 > 480)
-		y1 = 480;
-
-	if(y0 < 0) {
-		xl += -dxldy*y0;
-		xr += -dxrdy*y0;
-		ul += -duldy*y0;
-		ur += -durdy*y0;
-		vl += -dvldy*y0;
-		vr += -dvrdy*y0;
-		wl += -dwldy*y0;
-		wr += -dwrdy*y0;
-		y0 = 0;
+	if(y1 > clip.max_y + 1)
+		y1 = clip.max_y + 1;
+
+	if(y0 < clip.min_y) {
+		float skip = clip.min_y - y0;
+		xl += dxldy*skip;
+		xr += dxrdy*skip;
+		ul += duldy*skip;
+		ur += durdy*skip;
+		vl += dvldy*skip;
+		vr += dvrdy*skip;
+		wl += dwldy*skip;
+		wr += dwrdy*skip;
+		y0 = clip.min_y;
 	}
 
 	yy0 = round(y0);
@@ -2311,7 +2314,7 @@ void powervr2_device::render_span(bitmap_rgb32 &bitmap, texinfo *ti,
 	wr += dy*dwrdy;
 
 	while(yy0 < yy1) {
-		render_hline(bitmap, ti, yy0, xl, xr, ul, ur, vl, vr, wl, wr);
+		render_hline(bitmap, clip, ti, yy0, xl, xr, ul, ur, vl, vr, wl, wr);
 
 		xl += dxldy;
 		xr += dxrdy;
@@ -2356,13 +2359,13 @@ void powervr2_device::sort_vertices(const vert *v, int *i0, int *i1, int *i2)
 }
 
 
-void powervr2_device::render_tri_sorted(bitmap_rgb32 &bitmap, texinfo *ti, const vert *v0, const vert *v1, const vert *v2)
+void powervr2_device::render_tri_sorted(bitmap_rgb32 &bitmap, const rectangle &clip, texinfo *ti, const vert *v0, const vert *v1, const vert *v2)
 {
 	float dy01, dy02, dy12;
 
 	float dx01dy, dx02dy, dx12dy, du01dy, du02dy, du12dy, dv01dy, dv02dy, dv12dy, dw01dy, dw02dy, dw12dy;
 
-	if(v0->y >= 480 || v2->y < 0)
+	if(v0->y >= clip.max_y + 1 || v2->y < clip.min_y)
 		return;
 
 	dy01 = v1->y - v0->y;
@@ -2390,41 +2393,102 @@ void powervr2_device::render_tri_sorted(bitmap_rgb32 &bitmap, texinfo *ti, const
 			return;
 
 		if(v1->x > v0->x)
-			render_span(bitmap, ti, v1->y, v2->y, v0->x, v1->x, v0->u, v1->u, v0->v, v1->v, v0->w, v1->w, dx02dy, dx12dy, du02dy, du12dy, dv02dy, dv12dy, dw02dy, dw12dy);
+			render_span(bitmap, clip, ti, v1->y, v2->y, v0->x, v1->x, v0->u, v1->u, v0->v, v1->v, v0->w, v1->w, dx02dy, dx12dy, du02dy, du12dy, dv02dy, dv12dy, dw02dy, dw12dy);
 		else
-			render_span(bitmap, ti, v1->y, v2->y, v1->x, v0->x, v1->u, v0->u, v1->v, v0->v, v1->w, v0->w, dx12dy, dx02dy, du12dy, du02dy, dv12dy, dv02dy, dw12dy, dw02dy);
+			render_span(bitmap, clip, ti, v1->y, v2->y, v1->x, v0->x, v1->u, v0->u, v1->v, v0->v, v1->w, v0->w, dx12dy, dx02dy, du12dy, du02dy, dv12dy, dv02dy, dw12dy, dw02dy);
 
 	} else if(!dy12) {
 		if(v2->x > v1->x)
-			render_span(bitmap, ti, v0->y, v1->y, v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, dx01dy, dx02dy, du01dy, du02dy, dv01dy, dv02dy, dw01dy, dw02dy);
+			render_span(bitmap, clip, ti, v0->y, v1->y, v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, dx01dy, dx02dy, du01dy, du02dy, dv01dy, dv02dy, dw01dy, dw02dy);
 		else
-			render_span(bitmap, ti, v0->y, v1->y, v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, dx02dy, dx01dy, du02dy, du01dy, dv02dy, dv01dy, dw02dy, dw01dy);
+			render_span(bitmap, clip, ti, v0->y, v1->y, v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, dx02dy, dx01dy, du02dy, du01dy, dv02dy, dv01dy, dw02dy, dw01dy);
 
 	} else {
 		if(dx01dy < dx02dy) {
-			render_span(bitmap, ti, v0->y, v1->y,
+			render_span(bitmap, clip, ti, v0->y, v1->y,
 						v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w,
 						dx01dy, dx02dy, du01dy, du02dy, dv01dy, dv02dy, dw01dy, dw02dy);
-			render_span(bitmap, ti, v1->y, v2->y,
+			render_span(bitmap, clip, ti, v1->y, v2->y,
 						v1->x, v0->x + dx02dy*dy01, v1->u, v0->u + du02dy*dy01, v1->v, v0->v + dv02dy*dy01, v1->w, v0->w + dw02dy*dy01,
 						dx12dy, dx02dy, du12dy, du02dy, dv12dy, dv02dy, dw12dy, dw02dy);
 		} else {
-			render_span(bitmap, ti, v0->y, v1->y,
+			render_span(bitmap, clip, ti, v0->y, v1->y,
 						v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w,
 						dx02dy, dx01dy, du02dy, du01dy, dv02dy, dv01dy, dw02dy, dw01dy);
-			render_span(bitmap, ti, v1->y, v2->y,
+			render_span(bitmap, clip, ti, v1->y, v2->y,
 						v0->x + dx02dy*dy01, v1->x, v0->u + du02dy*dy01, v1->u, v0->v + dv02dy*dy01, v1->v, v0->w + dw02dy*dy01, v1->w,
 						dx02dy, dx12dy, du02dy, du12dy, dv02dy, dv12dy, dw02dy, dw12dy);
 		}
 	}
 }
 
-void powervr2_device::render_tri(bitmap_rgb32 &bitmap, texinfo *ti, const vert *v)
+void powervr2_device::render_tri(bitmap_rgb32 &bitmap, const rectangle &clip, texinfo *ti, const vert *v)
 {
 	int i0, i1, i2;
 
 	sort_vertices(v, &i0, &i1, &i2);
-	render_tri_sorted(bitmap, ti, v+i0, v+i1, v+i2);
+	render_tri_sorted(bitmap, clip, ti, v+i0, v+i1, v+i2);
+}
+
+// split the render area into 32x32 tiles, in screen order
+void powervr2_device::setup_render_tiles(const rectangle &area)
+{
+	if(area == m_render_area && !m_render_tiles.empty())
+		return;
+
+	m_render_area = area;
+	m_render_tiles_x = (area.width() + TILE_SIZE - 1) / TILE_SIZE;
+	int tiles_y = (area.height() + TILE_SIZE - 1) / TILE_SIZE;
+
+	m_render_tiles.clear();
+	m_render_tiles.resize(m_render_tiles_x * tiles_y);
+	for(int t = 0; t < m_render_tiles.size(); t++)
+	{
+		int tx = area.min_x + (t % m_render_tiles_x) * TILE_SIZE;
+		int ty = area.min_y + (t / m_render_tiles_x) * TILE_SIZE;
+		m_render_tiles[t].device = this;
+		m_render_tiles[t].clip.set(tx, tx + TILE_SIZE - 1, ty, ty + TILE_SIZE - 1);
+		m_render_tiles[t].clip &= area;
+	}
+	m_busy_tiles.reserve(m_render_tiles.size());
+}
+
+// add a triangle to the list of every 32x32 tile its bounding box touches
+void powervr2_device::bin_tri(int strip, int vertex, const vert *v)
+{
+	const rectangle &area = m_render_area;
+	float minx = std::min(v[0].x, std::min(v[1].x, v[2].x));
+	float maxx = std::max(v[0].x, std::max(v[1].x, v[2].x));
+	float miny = std::min(v[0].y, std::min(v[1].y, v[2].y));
+	float maxy = std::max(v[0].y, std::max(v[1].y, v[2].y));
+
+	// reject offscreen (and NaN) triangles before converting to integers
+	if(!(maxx >= area.min_x && minx <= area.max_x && maxy >= area.min_y && miny <= area.max_y))
+		return;
+
+	int tx0 = (int(std::max(minx, float(area.min_x))) - area.min_x) / TILE_SIZE;
+	int tx1 = (std::min(int(std::min(maxx, float(area.max_x))) + 1, area.max_x) - area.min_x) / TILE_SIZE;
+	int ty0 = (int(std::max(miny, float(area.min_y))) - area.min_y) / TILE_SIZE;
+	int ty1 = (std::min(int(std::min(maxy, float(area.max_y))) + 1, area.max_y) - area.min_y) / TILE_SIZE;
+
+	UINT32 tri = (strip << 16) | vertex;
+	for(int ty = ty0; ty <= ty1; ty++)
+		for(int tx = tx0; tx <= tx1; tx++)
+			m_render_tiles[ty * m_render_tiles_x + tx].tris.push_back(tri);
+}
+
+void *powervr2_device::render_tile_callback(void *param, int threadid)
+{
+	render_tile *tile = *(render_tile **)param;
+	powervr2_device *pvr = tile->device;
+	receiveddata &rd = pvr->grab[pvr->m_render_select];
+
+	for(UINT32 tri : tile->tris)
+	{
+		strip *ts = &rd.strips[tri >> 16];
+		pvr->render_tri(*pvr->m_render_bitmap, tile->clip, &ts->ti, rd.verts + (tri & 0xffff));
+	}
+	return nullptr;
 }
 
 void powervr2_device::render_to_accumulation_buffer(bitmap_rgb32 &bitmap,const rectangle &cliprect)
@@ -2448,6 +2512,11 @@ void powervr2_device::render_to_accumulation_buffer(bitmap_rgb32 &bitmap,const r
 	bitmap.fill(c, cliprect);
 
 
+	// only the part of the clip covered by the W-buffer can be rendered
+	rectangle area(0, ARRAY_LENGTH(wbuffer[0]) - 1, 0, ARRAY_LENGTH(wbuffer) - 1);
+	area &= cliprect;
+	setup_render_tiles(area);
+
 	int ns=grab[rs].strips_size;
 	if(ns)
 		memset(wbuffer, 0x00, sizeof(wbuffer));
@@ -2471,10 +2540,35 @@ void powervr2_device::render_to_accumulation_buffer(bitmap_rgb32 &bitmap,const r
 		for(i=sv; i <= ev-2; i++)
 		{
 			if (!(debug_dip_status&0x2))
-				render_tri(bitmap, &ts->ti, grab[rs].verts + i);
+				bin_tri(cs, i, grab[rs].verts + i);
 
 		}
 	}
+
+	// rasterize the tiles in parallel; each tile still draws its triangles in list order
+	m_render_bitmap = &bitmap;
+	m_render_select = rs;
+	m_busy_tiles.clear();
+	for (auto &tile : m_render_tiles)
+		if (!tile.tris.empty())
+			m_busy_tiles.push_back(&tile);
+	if (m_render_queue != nullptr && m_busy_tiles.size() > 1)
+	{
+		osd_work_item_queue_multiple(m_render_queue, render_tile_callback, m_busy_tiles.size(), &m_busy_tiles[0], sizeof(m_busy_tiles[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+
+		// the tile lists can't be cleared while any worker is still reading them
+		if (!osd_work_queue_wait(m_render_queue, osd_ticks_per_second() * 10))
+		{
+			logerror("%s: tile rendering still running after 10 seconds, waiting\n", tag());
+			while (!osd_work_queue_wait(m_render_queue, osd_ticks_per_second()))
+				;
+		}
+	}
+	else
+		for (auto &tile : m_busy_tiles)
+			render_tile_callback(&tile, 0);
+	for (auto tile : m_busy_tiles)
+		tile->tris.clear();
 	grab[rs].busy=0;
 }
 
@@ -3633,6 +3727,9 @@ void powervr2_device::device_start()
 
 	fake_accumulationbuffer_bitmap = std::make_unique<bitmap_rgb32>(2048,2048);
 
+	m_render_tiles_x = 0;
+	m_render_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+
 	softreset = 0;
 	param_base = 0;
 	region_base = 0;
@@ -3748,6 +3845,13 @@ void powervr2_device::device_start()
 	save_item(NAME(next_y));
 }
 
+void powervr2_device::device_stop()
+{
+	if (m_render_queue != nullptr)
+		osd_work_queue_free(m_render_queue);
+	m_render_queue = nullptr;
+}
+
 void powervr2_device::device_reset()
 {
 	softreset =                 0x00000007;
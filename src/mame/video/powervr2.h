@@ -54,7 +54,7 @@ public:
 
 
 	// the real accumulation buffer is a 32x32x8bpp buffer into which tiles get rendered before they get copied to the framebuffer
-	//  our implementation is not currently tile based, and thus the accumulation buffer is screen sized
+	//  our implementation renders 32x32 tiles in parallel, but still into a screen sized accumulation buffer
 	std::unique_ptr<bitmap_rgb32> fake_accumulationbuffer_bitmap;
 
 	struct texinfo  {
@@ -127,6 +127,23 @@ public:
 	UINT64 *elan_ram;
 
 	UINT32 debug_dip_status;
+
+	// tile binning for the threaded renderer
+	enum { TILE_SIZE = 32 };
+	struct render_tile
+	{
+		powervr2_device *device;
+		rectangle clip;
+		std::vector<UINT32> tris;     // (strip << 16) | first vertex, in list order
+	};
+	std::vector<render_tile> m_render_tiles;    // in screen order, m_render_tiles_x per row
+	std::vector<render_tile *> m_busy_tiles;    // tiles with triangles, handed to the work queue
+	rectangle m_render_area;
+	int m_render_tiles_x;
+	osd_work_queue *m_render_queue;
+	bitmap_rgb32 *m_render_bitmap;
+	int m_render_select;
+
 	emu_timer *vbout_timer;
 	emu_timer *vbin_timer;
 	emu_timer *hbin_timer;
@@ -279,6 +296,7 @@ public:
 
 protected:
 	virtual void device_start() override;
+	virtual void device_stop() override;
 	virtual void device_reset() override;
 
 private:
@@ -432,8 +450,8 @@ private:
 	UINT32 tex_r_default(texinfo *t, float x, float y);
 	void tex_get_info(texinfo *t);
 
-	void render_hline(bitmap_rgb32 &bitmap, texinfo *ti, int y, float xl, float xr, float ul, float ur, float vl, float vr, float wl, float wr);
-	void render_span(bitmap_rgb32 &bitmap, texinfo *ti,
+	void render_hline(bitmap_rgb32 &bitmap, const rectangle &clip, texinfo *ti, int y, float xl, float xr, float ul, float ur, float vl, float vr, float wl, float wr);
+	void render_span(bitmap_rgb32 &bitmap, const rectangle &clip, texinfo *ti,
 						float y0, float y1,
 						float xl, float xr,
 						float ul, float ur,
@@ -444,8 +462,11 @@ private:
 						float dvldy, float dvrdy,
 						float dwldy, float dwrdy);
 	void sort_vertices(const vert *v, int *i0, int *i1, int *i2);
-	void render_tri_sorted(bitmap_rgb32 &bitmap, texinfo *ti, const vert *v0, const vert *v1, const vert *v2);
-	void render_tri(bitmap_rgb32 &bitmap, texinfo *ti, const vert *v);
+	void render_tri_sorted(bitmap_rgb32 &bitmap, const rectangle &clip, texinfo *ti, const vert *v0, const vert *v1, const vert *v2);
+	void render_tri(bitmap_rgb32 &bitmap, const rectangle &clip, texinfo *ti, const vert *v);
+	void setup_render_tiles(const rectangle &area);
+	void bin_tri(int strip, int vertex, const vert *v);
+	static void *render_tile_callback(void *param, int threadid);
 	void render_to_accumulation_buffer(bitmap_rgb32 &bitmap, const rectangle &cliprect);
 	void pvr_accumulationbuffer_to_framebuffer(address_space &space, int x, int y);
 	void pvr_drawframebuffer(bitmap_rgb32 &bitmap,const rectangle &cliprect);
@@ -469,6 +469,9 @@ void osd_sleep(osd_ticks_t duration);
    its deconstruction */
 #define WORK_ITEM_FLAG_AUTO_RELEASE 0x0001
 
+/* pass this as the timeout to osd_work_queue_wait to wait until the queue is empty */
+#define WORK_QUEUE_WAIT_INFINITE    (~(osd_ticks_t)0)
+
 /* osd_work_queue is an opaque type which represents a queue of work items */
 struct osd_work_queue;
 
@@ -528,6 +531,24 @@ osd_work_queue *osd_work_queue_alloc(int flags);
 int osd_work_queue_items(osd_work_queue *queue);
 
 
+/*-----------------------------------------------------------------------------
+    osd_work_queue_threads: return the number of worker threads servicing
+    the queue
+
+    Parameters:
+
+        queue - pointer to an osd_work_queue that was previously created via
+            osd_work_queue_alloc
+
+    Return value:
+
+        The number of threads created for the queue, not counting the
+        calling thread that also processes items on WORK_QUEUE_FLAG_MULTI
+        queues. This reflects -numprocessors and OSDPROCESSORS.
+-----------------------------------------------------------------------------*/
+int osd_work_queue_threads(osd_work_queue *queue);
+
+
 /*-----------------------------------------------------------------------------
     osd_work_queue_wait: wait for the queue to be empty
 
@@ -536,12 +557,13 @@ int osd_work_queue_items(osd_work_queue *queue);
         queue - pointer to an osd_work_queue that was previously created via
             osd_work_queue_alloc
 
-        timeout - a timeout value in osd_ticks_per_second()
+        timeout - a timeout value in osd_ticks_per_second(), or
+            WORK_QUEUE_WAIT_INFINITE to wait with no time limit
 
     Return value:
 
         TRUE if the queue is empty; FALSE if the wait timed out before the
-        queue was emptied.
+        queue was emptied. Always TRUE with WORK_QUEUE_WAIT_INFINITE.
 -----------------------------------------------------------------------------*/
 int osd_work_queue_wait(osd_work_queue *queue, osd_ticks_t timeout);
 
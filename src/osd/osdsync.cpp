@@ -329,6 +329,17 @@ int osd_work_queue_items(osd_work_queue *queue)
 }
 
 
+//============================================================
+//  osd_work_queue_threads
+//============================================================
+
+int osd_work_queue_threads(osd_work_queue *queue)
+{
+	// return the number of threads created for the queue
+	return queue->threads;
+}
+
+
 //============================================================
 //  osd_work_queue_wait
 //============================================================
@@ -343,6 +354,14 @@ int osd_work_queue_wait(osd_work_queue *queue, osd_ticks_t timeout)
 	if (queue->items == 0)
 		return TRUE;
 
+	// with no time limit, wait a second at a time until the queue is empty
+	if (timeout == WORK_QUEUE_WAIT_INFINITE)
+	{
+		while (!osd_work_queue_wait(queue, osd_ticks_per_second()))
+			;
+		return TRUE;
+	}
+
 	// if this is a multi queue, help out rather than doing nothing
 	if (queue->flags & WORK_QUEUE_FLAG_MULTI)
 	{
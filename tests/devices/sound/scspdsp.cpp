@@ -0,0 +1,300 @@
+#include "gtest/gtest.h"
+#include "emu.h"
+#include "sound/scspdsp.h"
+
+#include <vector>
+
+namespace {
+
+// the SCSP DSP as it was interpreted before microprogram steps were pre-decoded
+
+UINT16 reference_pack(INT32 val)
+{
+   UINT32 temp;
+   int sign,exponent,k;
+
+   sign = (val >> 23) & 0x1;
+   temp = (val ^ (val << 1)) & 0xFFFFFF;
+   exponent = 0;
+   for (k=0; k<12; k++)
+   {
+      if (temp & 0x800000)
+         break;
+      temp <<= 1;
+      exponent += 1;
+   }
+   if (exponent < 12)
+      val = (val << exponent) & 0x3FFFFF;
+   else
+      val <<= 11;
+   val >>= 11;
+   val &= 0x7FF;
+   val |= sign << 15;
+   val |= exponent << 11;
+
+   return (UINT16)val;
+}
+
+INT32 reference_unpack(UINT16 val)
+{
+   int sign,exponent,mantissa;
+   INT32 uval;
+
+   sign = (val >> 15) & 0x1;
+   exponent = (val >> 11) & 0xF;
+   mantissa = val & 0x7FF;
+   uval = mantissa << 11;
+   if (exponent > 11)
+   {
+      exponent = 11;
+      uval |= sign << 22;
+   }
+   else
+      uval |= (sign ^ 1) << 22;
+   uval |= sign << 23;
+   uval <<= 8;
+   uval >>= 8;
+   uval >>= exponent;
+
+   return uval;
+}
+
+void reference_step(SCSPDSP *DSP)
+{
+   INT32 ACC=0, SHIFTED=0, X, Y=0, B, INPUTS, MEMVAL=0, FRC_REG=0, Y_REG=0;
+   UINT32 ADDR, ADRS_REG=0;
+
+   if(DSP->Stopped)
+      return;
+
+   memset(DSP->EFREG,0,2*16);
+   for(int step=0;step<DSP->LastStep;++step)
+   {
+      UINT16 *IPtr=DSP->MPRO+step*4;
+
+      UINT32 TRA=(IPtr[0]>>8)&0x7F;
+      UINT32 TWT=(IPtr[0]>>7)&0x01;
+      UINT32 TWA=(IPtr[0]>>0)&0x7F;
+
+      UINT32 XSEL=(IPtr[1]>>15)&0x01;
+      UINT32 YSEL=(IPtr[1]>>13)&0x03;
+      UINT32 IRA=(IPtr[1]>>6)&0x3F;
+      UINT32 IWT=(IPtr[1]>>5)&0x01;
+      UINT32 IWA=(IPtr[1]>>0)&0x1F;
+
+      UINT32 TABLE=(IPtr[2]>>15)&0x01;
+      UINT32 MWT=(IPtr[2]>>14)&0x01;
+      UINT32 MRD=(IPtr[2]>>13)&0x01;
+      UINT32 EWT=(IPtr[2]>>12)&0x01;
+      UINT32 EWA=(IPtr[2]>>8)&0x0F;
+      UINT32 ADRL=(IPtr[2]>>7)&0x01;
+      UINT32 FRCL=(IPtr[2]>>6)&0x01;
+      UINT32 SHIFT=(IPtr[2]>>4)&0x03;
+      UINT32 YRL=(IPtr[2]>>3)&0x01;
+      UINT32 NEGB=(IPtr[2]>>2)&0x01;
+      UINT32 ZERO=(IPtr[2]>>1)&0x01;
+      UINT32 BSEL=(IPtr[2]>>0)&0x01;
+
+      UINT32 NOFL=(IPtr[3]>>15)&1;
+      UINT32 COEF=(IPtr[3]>>9)&0x3f;
+
+      UINT32 MASA=(IPtr[3]>>2)&0x1f;
+      UINT32 ADREB=(IPtr[3]>>1)&0x1;
+      UINT32 NXADR=(IPtr[3]>>0)&0x1;
+
+      if(IRA<=0x1f)
+         INPUTS=DSP->MEMS[IRA];
+      else if(IRA<=0x2F)
+         INPUTS=DSP->MIXS[IRA-0x20]<<4;
+      else if(IRA<=0x31)
+         INPUTS=0;
+      else
+         return;
+
+      INPUTS<<=8;
+      INPUTS>>=8;
+
+      if(IWT)
+      {
+         DSP->MEMS[IWA]=MEMVAL;
+         if(IRA==IWA)
+            INPUTS=MEMVAL;
+      }
+
+      if(!ZERO)
+      {
+         if(BSEL)
+            B=ACC;
+         else
+         {
+            B=DSP->TEMP[(TRA+DSP->DEC)&0x7F];
+            B<<=8;
+            B>>=8;
+         }
+         if(NEGB)
+            B=0-B;
+      }
+      else
+         B=0;
+
+      if(XSEL)
+         X=INPUTS;
+      else
+      {
+         X=DSP->TEMP[(TRA+DSP->DEC)&0x7F];
+         X<<=8;
+         X>>=8;
+      }
+
+      if(YSEL==0)
+         Y=FRC_REG;
+      else if(YSEL==1)
+         Y=DSP->COEF[COEF]>>3;
+      else if(YSEL==2)
+         Y=(Y_REG>>11)&0x1FFF;
+      else if(YSEL==3)
+         Y=(Y_REG>>4)&0x0FFF;
+
+      if(YRL)
+         Y_REG=INPUTS;
+
+      if(SHIFT==0 || SHIFT==1)
+      {
+         SHIFTED=(SHIFT==0) ? ACC : ACC*2;
+         if(SHIFTED>0x007FFFFF)
+            SHIFTED=0x007FFFFF;
+         if(SHIFTED<(-0x00800000))
+            SHIFTED=-0x00800000;
+      }
+      else
+      {
+         SHIFTED=(SHIFT==2) ? ACC*2 : ACC;
+         SHIFTED<<=8;
+         SHIFTED>>=8;
+      }
+
+      Y<<=19;
+      Y>>=19;
+
+      ACC=(int)(((INT64) X*(INT64) Y)>>12)+B;
+
+      if(TWT)
+         DSP->TEMP[(TWA+DSP->DEC)&0x7F]=SHIFTED;
+
+      if(FRCL)
+      {
+         if(SHIFT==3)
+            FRC_REG=SHIFTED&0x0FFF;
+         else
+            FRC_REG=(SHIFTED>>11)&0x1FFF;
+      }
+
+      if(MRD || MWT)
+      {
+         ADDR=DSP->MADRS[MASA];
+         if(!TABLE)
+            ADDR+=DSP->DEC;
+         if(ADREB)
+            ADDR+=ADRS_REG&0x0FFF;
+         if(NXADR)
+            ADDR++;
+         if(!TABLE)
+            ADDR&=DSP->RBL-1;
+         else
+            ADDR&=0xFFFF;
+         ADDR+=DSP->RBP<<12;
+         if (ADDR > 0x7ffff) ADDR = 0;
+         if(MRD && (step&1))
+         {
+            if(NOFL)
+               MEMVAL=DSP->SCSPRAM[ADDR]<<8;
+            else
+               MEMVAL=reference_unpack(DSP->SCSPRAM[ADDR]);
+         }
+         if(MWT && (step&1))
+         {
+            if(NOFL)
+               DSP->SCSPRAM[ADDR]=SHIFTED>>8;
+            else
+               DSP->SCSPRAM[ADDR]=reference_pack(SHIFTED);
+         }
+      }
+
+      if(ADRL)
+      {
+         if(SHIFT==3)
+            ADRS_REG=(SHIFTED>>12)&0xFFF;
+         else
+            ADRS_REG=(INPUTS>>16);
+      }
+
+      if(EWT)
+         DSP->EFREG[EWA]+=SHIFTED>>8;
+   }
+   --DSP->DEC;
+   memset(DSP->MIXS,0,4*16);
+}
+
+// fixed pseudo-random source so every run uses the same program and input
+class fixed_random
+{
+public:
+   fixed_random() : m_state(0x2545f491) { }
+   UINT16 next() { m_state = m_state * 1103515245 + 12345; return m_state >> 16; }
+private:
+   UINT32 m_state;
+};
+
+} // anonymous namespace
+
+TEST(scspdsp,predecoded_matches_interpreter)
+{
+   fixed_random random;
+   std::vector<UINT16> ram(0x80000);
+   for (auto &word : ram)
+      word = random.next();
+   std::vector<UINT16> refram(ram);
+
+   auto dsp = std::make_unique<SCSPDSP>();
+   auto ref = std::make_unique<SCSPDSP>();
+   SCSPDSP_Init(dsp.get());
+   dsp->SCSPRAM = &ram[0];
+   dsp->SCSPRAM_LENGTH = ram.size();
+   dsp->RBP = 0x1f;
+   dsp->RBL = 0x4000;
+   for (auto &coef : dsp->COEF)
+      coef = random.next();
+   for (auto &madrs : dsp->MADRS)
+      madrs = random.next();
+   for (auto &temp : dsp->TEMP)
+      temp = INT32(random.next()) << 8;
+
+   // 120 steps exercising every field; IRA stays in range so no step ends the program early
+   for (int step = 0; step < 120; step++)
+   {
+      for (int word = 0; word < 4; word++)
+         dsp->MPRO[step * 4 + word] = random.next();
+      dsp->MPRO[step * 4 + 1] = (dsp->MPRO[step * 4 + 1] & ~(0x3f << 6)) | ((random.next() % 0x32) << 6);
+      SCSPDSP_Decode(dsp.get(), step);
+   }
+   SCSPDSP_Start(dsp.get());
+   *ref = *dsp;
+   ref->SCSPRAM = &refram[0];
+
+   for (int sample = 0; sample < 256; sample++)
+   {
+      for (int input = 0; input < 16; input++)
+      {
+         INT32 const value = (INT32(random.next()) << 4) - 0x80000;
+         SCSPDSP_SetSample(dsp.get(), value, input, 0);
+         SCSPDSP_SetSample(ref.get(), value, input, 0);
+      }
+      SCSPDSP_Step(dsp.get());
+      reference_step(ref.get());
+      ASSERT_EQ(0, memcmp(ref->EFREG, dsp->EFREG, sizeof(dsp->EFREG))) << "sample " << sample;
+      ASSERT_EQ(0, memcmp(ref->TEMP, dsp->TEMP, sizeof(dsp->TEMP))) << "sample " << sample;
+      ASSERT_EQ(0, memcmp(ref->MEMS, dsp->MEMS, sizeof(dsp->MEMS))) << "sample " << sample;
+      ASSERT_EQ(ref->DEC, dsp->DEC);
+   }
+   EXPECT_TRUE(refram == ram);
+}
@@ -0,0 +1,130 @@
+#include "gtest/gtest.h"
+#include "emu.h"
+#include "hashing.h"
+
+// the core is included directly so a chip can be built without a running machine
+#include "sound/ymf262.cpp"
+
+#include <memory>
+
+namespace {
+
+class opl3_chip
+{
+public:
+   opl3_chip()
+   {
+      OPL3_LockTable(nullptr);
+      m_chip = std::make_unique<OPL3>();
+      m_chip->type = OPL3_TYPE_YMF262;
+      m_chip->clock = 14318180;
+      m_chip->rate = 14318180 / 288;
+      OPL3_initalize(m_chip.get());
+      OPL3ResetChip(m_chip.get());
+   }
+   ~opl3_chip() { OPL3_UnLockTable(); }
+
+   void write(int reg, int data)
+   {
+      OPL3Write(m_chip.get(), (reg & 0x100) ? 2 : 0, reg & 0xff);
+      OPL3Write(m_chip.get(), 1, data);
+   }
+
+   // run for a number of samples, folding all four outputs into the CRC
+   void run(crc32_creator &crc, int samples)
+   {
+      OPL3SAMPLE buffer[4][256];
+      OPL3SAMPLE *buffers[4] = { buffer[0], buffer[1], buffer[2], buffer[3] };
+      while (samples > 0)
+      {
+         int const length = (std::min)(samples, 256);
+         ymf262_update_one(m_chip.get(), buffers, length);
+         for (auto &output : buffer)
+            crc.append(output, length * sizeof(output[0]));
+         samples -= length;
+      }
+   }
+
+   // set up both operators of a two-operator channel
+   void voice(int ch, int tl1, int tl2, int rates, int feedback)
+   {
+      static const int slot[9] = { 0x00, 0x01, 0x02, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12 };
+      int const base = ((ch >= 9) ? 0x100 : 0) + slot[ch % 9];
+      int const chbase = ((ch >= 9) ? 0x100 : 0) + (ch % 9);
+      write(0x20 + base, 0x21);
+      write(0x23 + base, 0x01);
+      write(0x40 + base, tl1);
+      write(0x43 + base, tl2);
+      write(0x60 + base, rates);
+      write(0x63 + base, rates);
+      write(0x80 + base, 0x24);
+      write(0x83 + base, 0x26);
+      write(0xe0 + base, ch & 7);
+      write(0xe3 + base, (ch + 3) & 7);
+      write(0xc0 + chbase, 0x30 | (feedback << 1) | (ch & 1));
+   }
+
+   void key(int ch, int fnum, int block, bool on)
+   {
+      int const chbase = ((ch >= 9) ? 0x100 : 0) + (ch % 9);
+      write(0xa0 + chbase, fnum & 0xff);
+      write(0xb0 + chbase, (on ? 0x20 : 0x00) | (block << 2) | ((fnum >> 8) & 3));
+   }
+
+private:
+   std::unique_ptr<OPL3> m_chip;
+};
+
+} // anonymous namespace
+
+// a few voices sounding over otherwise silent channels, including notes
+// decaying to silence, fully attenuated channels, 4-op pairs and rhythm mode;
+// the CRC was taken from the core before silent channels were skipped
+TEST(ymf262,silent_channels_golden)
+{
+   crc32_creator crc;
+   opl3_chip chip;
+
+   chip.write(0x105, 0x01);
+   chip.write(0x104, 0x01);
+
+   chip.voice(0, 0x10, 0x00, 0xf4, 5);     // 4-op pair with channel 3
+   chip.voice(3, 0x3f, 0x08, 0xf4, 0);
+   chip.voice(4, 0x18, 0x04, 0xa2, 3);
+   chip.voice(7, 0x3f, 0x3f, 0xf2, 7);     // keyed but fully attenuated
+   chip.voice(5, 0x04, 0x3f, 0xf4, 4);     // additive, only the first operator audible
+   chip.voice(10, 0x20, 0x00, 0xf8, 1);
+   chip.voice(15, 0x00, 0x00, 0xff, 6);
+
+   chip.key(0, 0x244, 4, true);
+   chip.key(3, 0x244, 4, true);
+   chip.key(4, 0x1ca, 5, true);
+   chip.key(7, 0x2ae, 3, true);
+   chip.key(5, 0x1ca, 4, true);
+   chip.run(crc, 4096);
+
+   chip.key(4, 0x1ca, 5, false);
+   chip.key(10, 0x158, 4, true);
+   chip.run(crc, 8192);
+
+   chip.key(0, 0x244, 4, false);
+   chip.key(3, 0x244, 4, false);
+   chip.key(10, 0x158, 4, false);
+   chip.key(5, 0x1ca, 4, false);
+   chip.run(crc, 32768);                   // everything decays to silence
+
+   chip.voice(6, 0x08, 0x00, 0xf6, 2);
+   chip.voice(8, 0x08, 0x00, 0xf6, 0);
+   chip.key(6, 0x200, 3, false);
+   chip.key(7, 0x180, 3, false);
+   chip.key(8, 0x1c0, 3, false);
+   chip.write(0xbd, 0x3f);                 // rhythm mode, all drums
+   chip.key(15, 0x2ae, 5, true);
+   chip.run(crc, 8192);
+
+   chip.write(0xbd, 0x20);
+   chip.key(15, 0x2ae, 5, false);
+   chip.run(crc, 16384);
+
+   EXPECT_EQ(0x1a73c0e2U, UINT32(crc.finish()));
+}
@@ -0,0 +1,38 @@
+#include "gtest/gtest.h"
+#include "arcindex.h"
+
+TEST(arcindex,crc)
+{
+   util::archive_index index;
+   index.add(0, "a.bin", true, 0x12345678);
+   index.add(1, "b.bin", true, 0x9abcdef0);
+   index.add(2, "c.bin", true, 0x12345678);
+   EXPECT_EQ(0, index.find(0x12345678, "", true, false, false));
+   EXPECT_EQ(1, index.find(0x9abcdef0, "", true, false, false));
+   EXPECT_EQ(-1, index.find(0x00000000, "", true, false, false));
+}
+
+TEST(arcindex,name)
+{
+   util::archive_index index;
+   index.add(0, "dir/Sub/A.BIN", true, 0x11111111);
+   index.add(1, "a.bin", true, 0x22222222);
+   EXPECT_EQ(1, index.find(0, "a.bin", false, true, false));
+   EXPECT_EQ(0, index.find(0, "a.bin", false, true, true));
+   EXPECT_EQ(0, index.find(0, "sub/a.bin", false, true, true));
+   EXPECT_EQ(-1, index.find(0, "ub/a.bin", false, true, true));
+   EXPECT_EQ(0, index.find(0, "DIR/SUB/a.bin", false, true, false));
+}
+
+TEST(arcindex,crcandname)
+{
+   util::archive_index index;
+   index.add(0, "a.bin", true, 0x11111111);
+   index.add(1, "x/a.bin", true, 0x22222222);
+   index.add(2, "y/a.bin", false, 0x22222222);
+   EXPECT_EQ(1, index.find(0x22222222, "a.bin", true, true, true));
+   EXPECT_EQ(-1, index.find(0x22222222, "a.bin", true, true, false));
+   EXPECT_EQ(-1, index.find(0x22222222, "y/a.bin", true, true, false));
+   index.clear();
+   EXPECT_EQ(-1, index.find(0x11111111, "a.bin", true, true, false));
+}